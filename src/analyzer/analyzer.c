@@ -8,40 +8,213 @@
 #include "utility/api.h"
 
 #include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/* State of a name in the analysis. */
+typedef struct {
+  /* Index of the symbol with the name on the table plus one. Zero if there is
+   * not a symbol with the name. */
+  size_t symbol;
+  /* Name of the definition with the name that was not analyzed because of
+   * failure but was seen. Empty if there is not a failed definition. */
+  String failed;
+} Name;
+
+/* Dynamic array of names in the order they are first seen in the analysis. */
+typedef struct {
+  /* Pointer to the first name if it exists. */
+  Name* first;
+  /* Pointer to one after the last name. */
+  Name* after;
+  /* Pointer to one after the last allocated name. */
+  Name* bound;
+} Names;
+
+/* Amount of name slots that is allocated when the slots grow from empty. */
+#define MIN_NAME_SLOTS 64
+
+/* Index of a name in the analysis with its interned identifier. */
+typedef struct {
+  /* Interned identifier plus one. Zero if the slot is empty. */
+  uint32_t identifier;
+  /* Index of the name in the names of the analysis. */
+  uint32_t index;
+} NameSlot;
+
+/* Way an expression node is analyzed. */
+typedef enum {
+  /* Evaluate the node without expecting a type. */
+  ANALYSIS_EVALUATE,
+  /* Evaluate the node and expect an arithmetic type. */
+  ANALYSIS_EVALUATE_ARITHMETIC,
+  /* Evaluate the node and expect an integer type. */
+  ANALYSIS_EVALUATE_INTEGER,
+  /* Check the node against the expected type. */
+  ANALYSIS_CHECK,
+  /* Check the node against the expected type if it is an integer; otherwise,
+   * evaluate the node and expect an integer type. */
+  ANALYSIS_CHECK_INTEGER
+} Analysis;
+
+/* Expression node whose operands are being analyzed. */
+typedef struct {
+  /* Analyzed node. */
+  ExpressionNode analyzed;
+  /* Way the node is analyzed. */
+  Analysis       analysis;
+  /* Type the node is checked against. */
+  Type           expected;
+  /* Way the operands of the node are analyzed. */
+  Analysis       operandAnalysis;
+  /* Amount of operands that are not entered yet. */
+  size_t         pending;
+  /* Amount of operands that returned a result. */
+  size_t         returned;
+  /* Results of the successful operands in the order they returned, which is
+   * from right to left. */
+  EvaluationNode operands[2];
+  /* Whether the checks of the node itself were successful. */
+  bool           valid;
+  /* Whether all the operands were successful. */
+  bool           succeeded;
+  /* Whether the node was finished as it was entered, without any operands. */
+  bool           finished;
+} PendingNode;
+
+/* Dynamic array of pending nodes, which is used as a stack. */
+typedef struct {
+  /* Pointer to the first pending node if it exists. */
+  PendingNode* first;
+  /* Pointer to one after the last pending node. */
+  PendingNode* after;
+  /* Pointer to one after the last allocated pending node. */
+  PendingNode* bound;
+} PendingNodes;
 
 /* Context of the analysis process. */
 typedef struct {
   /* Table to add the symbols into. */
-  Table*  target;
+  Table*       target;
   /* Source to report to. */
-  Source* reported;
+  Source*      reported;
   /* Analyzed parse. */
-  Parse   analyzed;
-  /* Map from the symbol name to the symbol's index on the table. */
-  Map     namesToIndices;
-  /* Symbol names that were not analyzed because of failure but was seen. */
-  Set     failedNames;
+  Parse        analyzed;
+  /* States of the names that were seen. */
+  Names        names;
+  /* Slots of the names, which are placed by their interned identifiers. */
+  NameSlot*    slots;
+  /* Amount of name slots, which is zero or a power of two. */
+  size_t       slotCount;
+  /* Nodes whose operands are being analyzed. */
+  PendingNodes pending;
+  /* Decimal literals that were parsed. */
+  LiteralCache literals;
+  /* Memory of the names, their slots and the pending nodes, which is released
+   * at once after the analysis. */
+  Arena        scratch;
 } Context;
 
-/* Push to table and insert to map the given symbol. */
-static void addSymbol(Context* context, Symbol added) {
+/* Slot the given interned identifier is placed first in the name slots of the
+ * given context. */
+static size_t findNameSlot(Context* context, uint32_t found) {
+  // Take the high half of the Fibonacci hash, which mixes all the bits.
+  return (size_t)(((uint64_t)found * 0x9E3779B97F4A7C15) >> 32) &
+         (context->slotCount - 1);
+}
+
+/* Double the amount of name slots and place the names again. */
+static void growNameSlots(Context* context) {
+  NameSlot* old      = context->slots;
+  size_t    oldCount = context->slotCount;
+  context->slotCount = oldCount ? oldCount * 2 : MIN_NAME_SLOTS;
+  context->slots =
+    allocateArenaArray(&context->scratch, NULL, context->slotCount, NameSlot);
+  memset(context->slots, 0, context->slotCount * sizeof(NameSlot));
+
+  for (size_t moved = 0; moved < oldCount; moved++) {
+    if (!old[moved].identifier) continue;
+    size_t index = findNameSlot(context, old[moved].identifier - 1);
+    while (context->slots[index].identifier)
+      index = (index + 1) & (context->slotCount - 1);
+    context->slots[index] = old[moved];
+  }
+  allocateArenaArray(&context->scratch, old, 0, NameSlot);
+}
+
+/* State of the name with the given interned identifier. Identifiers are shared
+ * by all the source files; thus, they are remapped to the indices of the names
+ * that are seen in the analysis, which keeps the memory of the names
+ * proportional to the analyzed file. Names that were not seen before are not
+ * defined. */
+static Name* accessName(Context* context, uint32_t accessed) {
+  // Keep at least half of the slots empty so that searches end quickly.
+  size_t known = context->names.after - context->names.first;
+  if (2 * (known + 1) > context->slotCount) growNameSlots(context);
+
+  size_t index = findNameSlot(context, accessed);
+  for (;; index = (index + 1) & (context->slotCount - 1)) {
+    NameSlot* slot = context->slots + index;
+    if (slot->identifier == accessed + 1)
+      return context->names.first + slot->index;
+    if (slot->identifier) continue;
+
+    *slot = (NameSlot){.identifier = accessed + 1, .index = (uint32_t)known};
+    reserveArenaArray(&context->scratch, &context->names, 1, Name);
+    *context->names.after = (Name){.symbol = 0, .failed = EMPTY_STRING};
+    return context->names.after++;
+  }
+}
+
+/* Push to table the given symbol, and record it as the symbol of the given
+ * identifier. */
+static void addSymbol(Context* context, uint32_t identifier, Symbol added) {
   // The index of the pushed symbol would be the current amount of symbols in
   // the table, which can be found from the difference of the pointers.
   size_t index = context->target->after - context->target->first;
-  insertEntry(&context->namesToIndices, added.name, index);
+  accessName(context, identifier)->symbol = index + 1;
   pushSymbol(context->target, added);
 }
 
+/* Amount of nodes whose operands are being analyzed. */
+static size_t countPendingNodes(Context* context) {
+  return context->pending.after - context->pending.first;
+}
+
+/* Add the given node to the top of the pending nodes. */
+static void pushPendingNode(Context* context, PendingNode pushed) {
+  reserveArenaArray(&context->scratch, &context->pending, 1, PendingNode);
+  *context->pending.after++ = pushed;
+}
+
+/* Add the given node with the given object to the end of the given
+ * evaluation, which is allocated from the table. */
+static void buildNode(
+  Context* context, Evaluation* built, ExpressionNode evaluated,
+  Object object) {
+  pushEvaluationNode(
+    &context->target->evaluations, built,
+    (EvaluationNode){.evaluated = evaluated, .object = object});
+}
+
+/* Section of the source file that has the given node. */
+static String findNodeSection(Context* context, ExpressionNode found) {
+  return getNodeSection(context->analyzed, found);
+}
+
 /* Prepare the given built-in type. */
 static void prepareType(Context* context, Type prepared) {
   Value  value  = {.asType = prepared};
   Object object = {.type = META_TYPE_INSTANCE, .value = value, .known = true};
+  String name   = viewTerminated(nameType(prepared));
   addSymbol(
-    context, (Symbol){
-               .tag         = SYMBOL_TYPE,
-               .name        = viewTerminated(nameType(prepared)),
-               .object      = object,
-               .userDefined = false});
+    context, internIdentifier(name),
+    (Symbol){
+      .tag         = SYMBOL_TYPE,
+      .name        = name,
+      .object      = object,
+      .userDefined = false});
 }
 
 /* Prepare the given built-in binding. */
@@ -49,12 +222,14 @@ static void prepareBinding(
   Context* context, char const* preparedName, Type preparedType,
   Value preparedValue) {
   Object object = {.type = preparedType, .value = preparedValue, .known = true};
+  String name   = viewTerminated(preparedName);
   addSymbol(
-    context, (Symbol){
-               .tag         = SYMBOL_BINDING,
-               .name        = viewTerminated(preparedName),
-               .object      = object,
-               .userDefined = false});
+    context, internIdentifier(name),
+    (Symbol){
+      .tag         = SYMBOL_BINDING,
+      .name        = name,
+      .object      = object,
+      .userDefined = false});
 }
 
 /* Setup the built-int symbols. */
@@ -73,12 +248,14 @@ static void prepare(Context* context) {
     context, "false", BOOL_TYPE_INSTANCE, (Value){.asBool = false});
 }
 
-/* Whether the definition of a new symbol with the given name is valid. */
-static bool checkDefinedName(Context* context, String checked) {
+/* Whether the definition of a new symbol with the given name and its interned
+ * identifier is valid. */
+static bool
+checkDefinedName(Context* context, String checked, uint32_t identifier) {
   // Check the successfully defined symbols.
-  MapEntry const* entry = accessEntry(context->namesToIndices, checked);
-  if (entry) {
-    Symbol previous = context->target->first[entry->value];
+  Name const* name = accessName(context, identifier);
+  if (name->symbol) {
+    Symbol previous = context->target->first[name->symbol - 1];
     if (previous.userDefined) {
       highlightError(
         context->reported, checked,
@@ -93,12 +270,12 @@ static bool checkDefinedName(Context* context, String checked) {
   }
 
   // Check the failed symbols.
-  String const* failed = accessMember(context->failedNames, checked);
-  if (failed) {
+  if (countCharacters(name->failed)) {
     highlightError(
       context->reported, checked,
       "Name clashes with a previously defined symbol!");
-    highlightInfo(context->reported, *failed, "Previous definition was here.");
+    highlightInfo(
+      context->reported, name->failed, "Previous definition was here.");
     return false;
   }
 
@@ -170,10 +347,9 @@ static bool checkAssignment(
   switch (destination.evaluated.operator) {
   // Check whether the assigned symbol is a variable.
   case SYMBOL_ACCESS: {
-    MapEntry const* entry =
-      accessEntry(context->namesToIndices, destination.evaluated.section);
-    expect(entry, "Access operation was not checked correctly!");
-    switch (context->target->first[entry->value].tag) {
+    Name const* name = accessName(context, destination.evaluated.identifier);
+    expect(name->symbol, "Access operation was not checked correctly!");
+    switch (context->target->first[name->symbol - 1].tag) {
     case SYMBOL_VARIABLE: break;
     default:
       highlightError(
@@ -184,7 +360,7 @@ static bool checkAssignment(
   }
   default:
     highlightError(
-      context->reported, destination.evaluated.section,
+      context->reported, findNodeSection(context, destination.evaluated),
       "Cannot assign to this expression!");
     result = false;
   }
@@ -192,24 +368,27 @@ static bool checkAssignment(
   return result;
 }
 
-// Prototype for recursive checking of expressions.
-static bool checkNode(
-  Context* context, Evaluation* built, ExpressionNode const** pointer,
-  Type expected);
-// Prototype for recursive evaluation of expressions.
-static bool evaluateNode(
-  Context* context, Evaluation* built, ExpressionNode const** pointer);
+/* Given object converted to the given type. */
+static Object convertObject(Object converted, Type destination) {
+  // If known, convert the value.
+  if (converted.known)
+    converted.value =
+      convertValue(converted.type, destination, converted.value);
+  converted.type = destination;
+  return converted;
+}
 
-/* Call `evaluateNode` and check whether the result is an arithmetic type. */
-static bool evaluateArithmeticNode(
-  Context* context, Evaluation* built, ExpressionNode const** pointer) {
-  if (!evaluateNode(context, built, pointer)) return false;
+/* Convert the object of the last built one to the given type. */
+static void convertLastBuiltNode(Evaluation* built, Type destination) {
+  built->after[-1].object = convertObject(built->after[-1].object, destination);
+}
 
-  // Check whether the type is arithmetic.
+/* Whether the last built node has an arithmetic type. */
+static bool checkArithmeticResult(Context* context, Evaluation* built) {
   EvaluationNode result = built->after[-1];
   if (!checkArithmeticity(result.object.type)) {
     highlightError(
-      context->reported, result.evaluated.section,
+      context->reported, findNodeSection(context, result.evaluated),
       "Expected a number, but found a `%s`!", nameType(result.object.type));
     return false;
   }
@@ -217,16 +396,12 @@ static bool evaluateArithmeticNode(
   return true;
 }
 
-/* Call `evaluateNode` and check whether the result is an integer type. */
-static bool evaluateIntegerNode(
-  Context* context, Evaluation* built, ExpressionNode const** pointer) {
-  if (!evaluateNode(context, built, pointer)) return false;
-
-  // Check whether the type is integer.
+/* Whether the last built node has an integer type. */
+static bool checkIntegerResult(Context* context, Evaluation* built) {
   EvaluationNode result = built->after[-1];
   if (!checkIntegerness(result.object.type)) {
     highlightError(
-      context->reported, result.evaluated.section,
+      context->reported, findNodeSection(context, result.evaluated),
       "Expected an integer, but found a `%s`!", nameType(result.object.type));
     return false;
   }
@@ -234,52 +409,84 @@ static bool evaluateIntegerNode(
   return true;
 }
 
-/* Convert the object of the last built one to the given type. */
-static void convertLastBuiltNode(Evaluation* built, Type destination) {
-  // If known, convert the value.
-  if (built->after[-1].object.known) {
-    built->after[-1].object.value = convertValue(
-      built->after[-1].object.type, destination, built->after[-1].object.value);
-  }
-  built->after[-1].object.type = destination;
+/* Whether the pending node can be finished as it is entered. */
+static void finishEntered(PendingNode* finished, bool result) {
+  finished->finished = true;
+  finished->valid    = result;
 }
 
-/* Call `checkNode` with it if it is an integer, otherwise calls
- * `evaluateIntegerNode`. */
-static bool checkIntegerNode(
-  Context* context, Evaluation* built, ExpressionNode const** pointer,
-  Type expected) {
-  // Even if the expected type is not an integer, the checked node should be.
-  if (!checkIntegerness(expected))
-    return evaluateIntegerNode(context, built, pointer);
+/* Wait for the given amount of operands of the given pending node, which are
+ * analyzed in the given way. */
+static void
+awaitOperands(PendingNode* waiting, size_t count, Analysis analysis) {
+  waiting->pending         = count;
+  waiting->operandAnalysis = analysis;
+}
 
-  return checkNode(context, built, pointer, expected);
+/* Delegate the checking of the given pending node to its unchecked version,
+ * whose result has the given type. The node is evaluated again as its own
+ * operand. */
+static void delegateEntered(
+  Context* context, ExpressionNode const** pointer, PendingNode* delegated,
+  Type resultType) {
+  // Roll back the consumed expression node.
+  (*pointer)++;
+
+  // Check the expected type. Store the result for reporting multiple errors.
+  delegated->valid = checkExpectedType(
+    context, findNodeSection(context, delegated->analyzed), resultType,
+    delegated->expected);
+
+  // Delegate to the unchecked version.
+  awaitOperands(delegated, 1, ANALYSIS_EVALUATE);
 }
 
-/* Version of `checkNode` with a nullary operator. */
+/* Finish the given pending node that was delegated to its unchecked version. */
+static bool leaveDelegated(Evaluation* built, PendingNode left) {
+  if (!left.succeeded) return false;
+
+  // If the expected type failed, remove the last built node.
+  if (!left.valid) {
+    built->after--;
+    return false;
+  }
+
+  // Convert the result of the unchecked version.
+  convertLastBuiltNode(built, left.expected);
+  return true;
+}
+
+/* Push a node with the given object for the given pending node if all of its
+ * operands and checks were successful. */
+static bool leaveWithObject(
+  Context* context, Evaluation* built, PendingNode left, Object object) {
+  if (!left.valid || !left.succeeded) return false;
+  buildNode(context, built, left.analyzed, object);
+  return true;
+}
+
+/* Check the given nullary node against the given expected type. */
 static bool checkNullaryNode(
-  Context* context, Evaluation* built, ExpressionNode const** pointer,
-  Type expected) {
-  ExpressionNode checked = **pointer;
-  (*pointer)--;
+  Context* context, Evaluation* built, ExpressionNode checked, Type expected) {
   switch (checked.operator) {
   // Nullary operator that results in the accessed type.
   case SYMBOL_ACCESS: {
     // Check wheter the accessed symbol is defined.
-    MapEntry const* entry =
-      accessEntry(context->namesToIndices, checked.section);
-    if (!entry) {
+    Name const* name = accessName(context, checked.identifier);
+    if (!name->symbol) {
       // Check whether it was a failed symbol; then, fail silently.
-      if (!accessMember(context->failedNames, checked.section))
-        highlightError(context->reported, checked.section, "Unknown symbol!");
+      if (!countCharacters(name->failed))
+        highlightError(
+          context->reported, findNodeSection(context, checked),
+          "Unknown symbol!");
       return false;
     }
-    Symbol accessed = context->target->first[entry->value];
+    Symbol accessed = context->target->first[name->symbol - 1];
 
     // Check the type.
     if (!checkConvertability(accessed.object.type, expected)) {
       highlightError(
-        context->reported, checked.section,
+        context->reported, findNodeSection(context, checked),
         "Expected a `%s`, but `%.*s` is a `%s`!", nameType(expected),
         (int)countCharacters(accessed.name), accessed.name.first,
         nameType(accessed.object.type));
@@ -293,31 +500,26 @@ static bool checkNullaryNode(
         convertValue(accessed.object.type, expected, accessed.object.value);
       object.known = true;
     }
-    pushEvaluationNode(
-      built, (EvaluationNode){.evaluated = checked, .object = object});
+    buildNode(context, built, checked, object);
     return true;
   }
 
   // Nullary operator that results in an arithmetic type.
   case DECIMAL_LITERAL: {
-    // Check and consume the sign.
-    bool   negative = *checked.section.first == '-';
-    String parsed   = createString(
-        (negative || *checked.section.first == '+') + checked.section.first,
-        checked.section.after);
-
     // Store the result for reporting multiple errors.
     bool result = true;
 
-    // Parse the string to a decimal number.
-    Number decimal = parseDecimal(parsed);
-    if (decimal.flag == NUMBER_TOO_PRECISE) {
+    // Parse the string to a decimal number, unless it was parsed before.
+    CachedLiteral* literal =
+      accessLiteral(&context->literals, findNodeSection(context, checked));
+    if (literal->number.flag == NUMBER_TOO_PRECISE) {
       highlightError(
-        context->reported, checked.section, "The number is too long!");
+        context->reported, findNodeSection(context, checked),
+        "The number is too long!");
       result = false;
     }
 
-    Object object = {.known = true};
+    Object object = {.type = expected, .known = true};
 
     // Check whether the expected type is an arithmetic type and it is not a
     // Boolean algebra arithmetic.
@@ -325,42 +527,34 @@ static bool checkNullaryNode(
       !checkArithmeticity(expected) ||
       compareTypeEquality(expected, BOOL_TYPE_INSTANCE)) {
       highlightError(
-        context->reported, checked.section,
+        context->reported, findNodeSection(context, checked),
         "Expected a `%s`, but found a number!", nameType(expected));
       result = false;
     }
 
-    if (!result) {
-      disposeNumber(&decimal);
-      return false;
-    }
+    if (!result) return false;
 
     // Try to convert to the expeced arithmetic type.
     switch (
-      convertNumberToArithmetic(expected, &object.value, decimal, negative)) {
+      convertLiteral(&context->literals, &object.value, literal, expected)) {
     case NUMBER_CONVERSION_SUCCESS:
-      pushEvaluationNode(
-        built, (EvaluationNode){.evaluated = checked, .object = object});
-      disposeNumber(&decimal);
+      buildNode(context, built, checked, object);
       return true;
     case NUMBER_CONVERSION_NOT_INTEGER:
       highlightError(
-        context->reported, checked.section,
+        context->reported, findNodeSection(context, checked),
         "Expected a `%s`, but the number is not an integer!",
         nameType(expected));
-      disposeNumber(&decimal);
       return false;
     case NUMBER_CONVERSION_NOT_UNSIGNED:
       highlightError(
-        context->reported, checked.section,
+        context->reported, findNodeSection(context, checked),
         "Expected a `%s`, but the number is negative!", nameType(expected));
-      disposeNumber(&decimal);
       return false;
     case NUMBER_CONVERSION_OUT_OUF_BOUNDS:
       highlightError(
-        context->reported, checked.section, "Number is out of bounds of `%s`!",
-        nameType(expected));
-      disposeNumber(&decimal);
+        context->reported, findNodeSection(context, checked),
+        "Number is out of bounds of `%s`!", nameType(expected));
       return false;
     default: unexpected("Unknown number conversion result!");
     }
@@ -369,187 +563,177 @@ static bool checkNullaryNode(
   }
 }
 
-/* Version of `checkNode` with a prenary operator. */
-static bool checkPrenaryNode(
-  Context* context, Evaluation* built, ExpressionNode const** pointer,
-  Type expected) {
-  ExpressionNode checked = **pointer;
-  (*pointer)--;
-  switch (checked.operator) {
-  // Prenary operators taking any arithmetic and returning it.
-  case POSATE:
-  case NEGATE: {
-    if (
-      !checkExpectedArithmetic(context, checked.section, expected) ||
-      !checkNode(context, built, pointer, expected))
+/* Evaluate the given nullary node. */
+static bool evaluateNullaryNode(
+  Context* context, Evaluation* built, ExpressionNode evaluated) {
+  switch (evaluated.operator) {
+  // Nullary operator that results in the accessed type.
+  case SYMBOL_ACCESS: {
+    // Check wheter the accessed symbol is defined.
+    Name const* name = accessName(context, evaluated.identifier);
+    if (!name->symbol) {
+      // Check whether it was a failed symbol; then, fail silently.
+      if (!countCharacters(name->failed))
+        highlightError(
+          context->reported, findNodeSection(context, evaluated),
+          "Unknown symbol!");
       return false;
-    Object object = {.type = expected};
-    pushEvaluationNode(
-      built, (EvaluationNode){.evaluated = checked, .object = object});
-    return true;
-  }
+    }
 
-  // Prenary operator taking any integer and returning it.
-  case COMPLEMENT: {
-    if (
-      !checkExpectedArithmetic(context, checked.section, expected) ||
-      !checkIntegerNode(context, built, pointer, expected))
-      return false;
-    Object object = {.type = expected};
-    pushEvaluationNode(
-      built, (EvaluationNode){.evaluated = checked, .object = object});
+    // Create with the the accessed object.
+    Symbol accessed = context->target->first[name->symbol - 1];
+    buildNode(context, built, evaluated, accessed.object);
     return true;
   }
 
-  // Binary operators delegating to the unchecked version that returns bool.
-  case LOGICAL_NOT: {
-    // Roll back the consumed expression node.
-    (*pointer)++;
-
-    // Check the expected type.
-    // Store the result for reporting multiple errors.
-    bool result =
-      checkExpectedType(context, checked.section, BOOL_TYPE_INSTANCE, expected);
-
-    // Delegate to the unchecked version.
-    if (!evaluateNode(context, built, pointer)) return false;
-
-    // If the expected type failed, remove the last built node.
-    if (!result) {
-      built->after--;
+  // Nullary operator that results in an arithmetic type.
+  case DECIMAL_LITERAL: {
+    // Parse the string to a decimal number, unless it was parsed before.
+    CachedLiteral* literal =
+      accessLiteral(&context->literals, findNodeSection(context, evaluated));
+    if (literal->number.flag == NUMBER_TOO_PRECISE) {
+      highlightError(
+        context->reported, findNodeSection(context, evaluated),
+        "The number is too long!");
       return false;
     }
 
-    // Convert the result of the unchecked version.
-    convertLastBuiltNode(built, expected);
-    return true;
-  }
-
-  // Binary operators delegating to the unchecked version that returns void.
-  case PREFIX_INCREMENT:
-  case PREFIX_DECREMENT: {
-    // Roll back the consumed expression node.
-    (*pointer)++;
-
-    // Check the expected type.
-    // Store the result for reporting multiple errors.
-    bool result =
-      checkExpectedType(context, checked.section, VOID_TYPE_INSTANCE, expected);
-
-    // Delegate to the unchecked version.
-    if (!evaluateNode(context, built, pointer)) return false;
+    Object object = {.known = true};
 
-    // If the expected type failed, remove the last built node.
-    if (!result) {
-      built->after--;
-      return false;
+    // Default to an int.
+    if (
+      convertLiteral(
+        &context->literals, &object.value, literal, INT_TYPE_INSTANCE) ==
+      NUMBER_CONVERSION_SUCCESS) {
+      object.type = INT_TYPE_INSTANCE;
+    } else {
+      // Otherwise, it is inferred as double, which is always possible.
+      expect(
+        convertLiteral(
+          &context->literals, &object.value, literal, DOUBLE_TYPE_INSTANCE) ==
+          NUMBER_CONVERSION_SUCCESS,
+        "Failed to convert to a double!");
+      object.type = DOUBLE_TYPE_INSTANCE;
     }
-
-    // Convert the result of the unchecked version.
-    convertLastBuiltNode(built, expected);
+    buildNode(context, built, evaluated, object);
     return true;
   }
-  default: unexpected("Unknown prenary operator!");
+  default: unexpected("Unknown nullary operator!");
   }
 }
 
-/* Version of `checkNode` with a postary operator. */
-static bool checkPostaryNode(
-  Context* context, Evaluation* built, ExpressionNode const** pointer,
-  Type expected) {
-  ExpressionNode checked = **pointer;
-  (*pointer)--;
+/* Evaluate the given variary node. */
+static bool evaluateVariaryNode(
+  Context* context, Evaluation* built, ExpressionNode evaluated) {
+  switch (evaluated.operator) {
+  case FUNCTION_CALL:
+    highlightWarning(
+      context->reported, findNodeSection(context, evaluated),
+      "Function call is not implemented.");
+    return false;
+  default: unexpected("Unknown variary operator!");
+  }
+}
+
+/* Check the given variary node against the given expected type. */
+static bool checkVariaryNode(
+  Context* context, Evaluation* built, ExpressionNode checked, Type expected) {
   switch (checked.operator) {
-  // Binary operators delegating to the unchecked version.
-  case POSTFIX_INCREMENT:
-  case POSTFIX_DECREMENT: {
-    // Roll back the consumed expression node.
-    (*pointer)++;
+  case FUNCTION_CALL:
+    highlightWarning(
+      context->reported, findNodeSection(context, checked),
+      "Function call is not implemented.");
+    return false;
+  default: unexpected("Unknown variary operator!");
+  }
+}
 
-    // Check the expected type.
-    // Store the result for reporting multiple errors.
-    bool result =
-      checkExpectedType(context, checked.section, VOID_TYPE_INSTANCE, expected);
+/* Enter the given pending node with a prenary operator that is checked. */
+static void enterCheckedPrenaryNode(
+  Context* context, ExpressionNode const** pointer, PendingNode* entered) {
+  ExpressionNode checked = entered->analyzed;
+  switch (checked.operator) {
+  // Prenary operators taking any arithmetic and returning it.
+  case POSATE:
+  case NEGATE:
+    if (!checkExpectedArithmetic(
+          context, findNodeSection(context, checked), entered->expected))
+      finishEntered(entered, false);
+    else awaitOperands(entered, 1, ANALYSIS_CHECK);
+    break;
 
-    // Delegate to the unchecked version.
-    if (!evaluateNode(context, built, pointer)) return false;
+  // Prenary operator taking any integer and returning it.
+  case COMPLEMENT:
+    if (!checkExpectedArithmetic(
+          context, findNodeSection(context, checked), entered->expected))
+      finishEntered(entered, false);
+    else awaitOperands(entered, 1, ANALYSIS_CHECK_INTEGER);
+    break;
 
-    // If the expected type failed, remove the last built node.
-    if (!result) {
-      built->after--;
-      return false;
-    }
+  // Prenary operator delegating to the unchecked version that returns bool.
+  case LOGICAL_NOT:
+    delegateEntered(context, pointer, entered, BOOL_TYPE_INSTANCE);
+    break;
 
-    // Convert the result of the unchecked version.
-    convertLastBuiltNode(built, expected);
-    return true;
+  // Prenary operators delegating to the unchecked version that returns void.
+  case PREFIX_INCREMENT:
+  case PREFIX_DECREMENT:
+    delegateEntered(context, pointer, entered, VOID_TYPE_INSTANCE);
+    break;
+  default: unexpected("Unknown prenary operator!");
   }
+}
+
+/* Enter the given pending node with a postary operator that is checked. */
+static void enterCheckedPostaryNode(
+  Context* context, ExpressionNode const** pointer, PendingNode* entered) {
+  switch (entered->analyzed.operator) {
+  // Postary operators delegating to the unchecked version that returns void.
+  case POSTFIX_INCREMENT:
+  case POSTFIX_DECREMENT:
+    delegateEntered(context, pointer, entered, VOID_TYPE_INSTANCE);
+    break;
   default: unexpected("Unknown postary operator!");
   }
 }
 
-/* Version of `checkNode` with a cirnary operator. */
-static bool checkCirnaryNode(
-  Context* context, Evaluation* built, ExpressionNode const** pointer,
-  Type expected) {
-  ExpressionNode checked = **pointer;
-  (*pointer)--;
-  switch (checked.operator) {
+/* Enter the given pending node with a cirnary operator that is checked. */
+static void enterCheckedCirnaryNode(PendingNode* entered) {
+  switch (entered->analyzed.operator) {
   // Cirnary operator taking any type and returning it.
-  case GROUP: {
-    if (!checkNode(context, built, pointer, expected)) return false;
-    Object object = {.type = expected};
-    pushEvaluationNode(
-      built, (EvaluationNode){.evaluated = checked, .object = object});
-    return true;
-  }
+  case GROUP: awaitOperands(entered, 1, ANALYSIS_CHECK); break;
   default: unexpected("Unknown cirnary operator!");
   }
 }
 
-/* Version of `checkNode` with a binary operator. */
-static bool checkBinaryNode(
-  Context* context, Evaluation* built, ExpressionNode const** pointer,
-  Type expected) {
-  ExpressionNode checked = **pointer;
-  (*pointer)--;
+/* Enter the given pending node with a binary operator that is checked. */
+static void enterCheckedBinaryNode(
+  Context* context, ExpressionNode const** pointer, PendingNode* entered) {
+  ExpressionNode checked = entered->analyzed;
   switch (checked.operator) {
   // Binary operators taking any arithmetic and returning it.
   case MULTIPLICATION:
   case DIVISION:
   case REMINDER:
   case ADDITION:
-  case SUBTRACTION: {
-    // Bitwise OR is used to report multiple errors.
-    if (
-      !checkExpectedArithmetic(context, checked.section, expected) ||
-      ((int)!checkNode(context, built, pointer, expected) | // Right operand.
-       !checkNode(context, built, pointer, expected)))      // Left operand.
-      return false;
-    Object object = {.type = expected};
-    pushEvaluationNode(
-      built, (EvaluationNode){.evaluated = checked, .object = object});
-    return true;
-  }
+  case SUBTRACTION:
+    if (!checkExpectedArithmetic(
+          context, findNodeSection(context, checked), entered->expected))
+      finishEntered(entered, false);
+    else awaitOperands(entered, 2, ANALYSIS_CHECK);
+    break;
 
   // Binary operators taking any integer and returning it.
   case LEFT_SHIFT:
   case RIGHT_SHIFT:
   case BITWISE_AND:
   case BITWISE_XOR:
-  case BITWISE_OR: {
-    // Bitwise OR is used to report multiple errors.
-    if (
-      !checkExpectedArithmetic(context, checked.section, expected) ||
-      ((int)!checkIntegerNode(
-         context, built, pointer, expected) |                 // Right operand.
-       !checkIntegerNode(context, built, pointer, expected))) // Left operand.
-      return false;
-    Object object = {.type = expected};
-    pushEvaluationNode(
-      built, (EvaluationNode){.evaluated = checked, .object = object});
-    return true;
-  }
+  case BITWISE_OR:
+    if (!checkExpectedArithmetic(
+          context, findNodeSection(context, checked), entered->expected))
+      finishEntered(entered, false);
+    else awaitOperands(entered, 2, ANALYSIS_CHECK_INTEGER);
+    break;
 
   // Binary operators taking any arithmetic and returning bool.
   case SMALLER_THAN:
@@ -559,19 +743,14 @@ static bool checkBinaryNode(
   case EQUAL_TO:
   case NOT_EQUAL_TO:
   case LOGICAL_AND:
-  case LOGICAL_OR: {
-    // Bitwise OR is used to report multiple errors.
-    if (
-      (int)!checkExpectedType(
-        context, checked.section, BOOL_TYPE_INSTANCE, expected) |
-      !evaluateArithmeticNode(context, built, pointer) | // Right operand.
-      !evaluateArithmeticNode(context, built, pointer))  // Left operand.
-      return false;
-    Object object = {.type = expected};
-    pushEvaluationNode(
-      built, (EvaluationNode){.evaluated = checked, .object = object});
-    return true;
-  }
+  case LOGICAL_OR:
+    // Operands are analyzed even if the expected type fails to report
+    // multiple errors.
+    entered->valid = checkExpectedType(
+      context, findNodeSection(context, checked), BOOL_TYPE_INSTANCE,
+      entered->expected);
+    awaitOperands(entered, 2, ANALYSIS_EVALUATE_ARITHMETIC);
+    break;
 
   // Binary operators delegating to the unchecked version.
   case ASSIGNMENT:
@@ -584,324 +763,330 @@ static bool checkBinaryNode(
   case RIGHT_SHIFT_ASSIGNMENT:
   case BITWISE_AND_ASSIGNMENT:
   case BITWISE_XOR_ASSIGNMENT:
-  case BITWISE_OR_ASSIGNMENT: {
-    // Roll back the consumed expression node.
-    (*pointer)++;
-
-    // Check the expected type.
-    // Store the result for reporting multiple errors.
-    bool result =
-      checkExpectedType(context, checked.section, VOID_TYPE_INSTANCE, expected);
-
-    // Delegate to the unchecked version.
-    if (!evaluateNode(context, built, pointer)) return false;
-
-    // If the expected type failed, remove the last built node.
-    if (!result) {
-      built->after--;
-      return false;
-    }
-
-    // Convert the result of the unchecked version.
-    convertLastBuiltNode(built, expected);
-    return true;
-  }
+  case BITWISE_OR_ASSIGNMENT:
+    delegateEntered(context, pointer, entered, VOID_TYPE_INSTANCE);
+    break;
   default: unexpected("Unknown binary operator!");
   }
 }
 
-/* Version of `checkNode` with a variary operator. */
-static bool checkVariaryNode(
-  Context* context, Evaluation* built, ExpressionNode const** pointer,
-  Type expected) {
-  ExpressionNode checked = **pointer;
-  (*pointer)--;
-  switch (checked.operator) {
-  case FUNCTION_CALL:
-    highlightWarning(
-      context->reported, checked.section, "Function call is not implemented.");
-    return false;
-  default: unexpected("Unknown variary operator!");
-  }
-}
-
-/* Check the given expression node. Returns the node that comes after the
- * given one and its childeren. Returns null if the evaluation failed or the
- * node did not have the expected type. */
-static bool checkNode(
+/* Enter the given pending node that is checked. */
+static void enterCheckedNode(
   Context* context, Evaluation* built, ExpressionNode const** pointer,
-  Type expected) {
-  ExpressionNode checked = **pointer;
-  switch (getOperator(checked.operator).tag) {
+  PendingNode* entered) {
+  switch (getOperator(entered->analyzed.operator).tag) {
   case OPERATOR_NULLARY:
-    return checkNullaryNode(context, built, pointer, expected);
+    finishEntered(
+      entered,
+      checkNullaryNode(context, built, entered->analyzed, entered->expected));
+    break;
   case OPERATOR_PRENARY:
-    return checkPrenaryNode(context, built, pointer, expected);
+    enterCheckedPrenaryNode(context, pointer, entered);
+    break;
   case OPERATOR_POSTARY:
-    return checkPostaryNode(context, built, pointer, expected);
-  case OPERATOR_CIRNARY:
-    return checkCirnaryNode(context, built, pointer, expected);
+    enterCheckedPostaryNode(context, pointer, entered);
+    break;
+  case OPERATOR_CIRNARY: enterCheckedCirnaryNode(entered); break;
   case OPERATOR_BINARY:
-    return checkBinaryNode(context, built, pointer, expected);
+    enterCheckedBinaryNode(context, pointer, entered);
+    break;
   case OPERATOR_VARIARY:
-    return checkVariaryNode(context, built, pointer, expected);
+    finishEntered(
+      entered,
+      checkVariaryNode(context, built, entered->analyzed, entered->expected));
+    break;
   default: unexpected("Unknown operator variant!");
   }
 }
 
-/* Evaluate the given expression and build it into the given evaluation; and
- * check its type. Returns whether the expression was successful and the
- * expression had the expected type. */
-static bool checkExpression(
-  Context* context, Evaluation* built, Expression checked, Type expected) {
-  // Check starting from the root node.
-  ExpressionNode const* start = checked.after - 1;
-  return checkNode(context, built, &start, expected);
-}
+/* Result of the given prenary, postary or cirnary node on the given operand.
+ * Result is known if the operand is known, and the operation is defined for
+ * it. */
+static Object foldUnaryNode(ExpressionNode folded, Object operand) {
+  Object object = {.type = VOID_TYPE_INSTANCE};
+  switch (folded.operator) {
+  // Operators taking any arithmetic and doing integer promotion.
+  case POSATE:
+  case NEGATE:
+  case COMPLEMENT:
+    object.type = findCombination(operand.type, INT_TYPE_INSTANCE);
+    break;
 
-/* Version of `evaluateNode` with a nullary operator. */
-static bool evaluateNullaryNode(
-  Context* context, Evaluation* built, ExpressionNode const** pointer) {
-  ExpressionNode evaluated = **pointer;
-  (*pointer)--;
-  switch (evaluated.operator) {
-  // Nullary operator that results in the accessed type.
-  case SYMBOL_ACCESS: {
-    // Check wheter the accessed symbol is defined.
-    MapEntry const* entry =
-      accessEntry(context->namesToIndices, evaluated.section);
-    if (!entry) {
-      // Check whether it was a failed symbol; then, fail silently.
-      if (!accessMember(context->failedNames, evaluated.section))
-        highlightError(context->reported, evaluated.section, "Unknown symbol!");
-      return false;
-    }
+  // Operator that always results in bool.
+  case LOGICAL_NOT: object.type = BOOL_TYPE_INSTANCE; break;
 
-    // Create with the the accessed object.
-    Symbol accessed = context->target->first[entry->value];
-    pushEvaluationNode(
-      built,
-      (EvaluationNode){.evaluated = evaluated, .object = accessed.object});
-    return true;
-  }
+  // Operators that always result in void, which are never known.
+  case PREFIX_INCREMENT:
+  case PREFIX_DECREMENT:
+  case POSTFIX_INCREMENT:
+  case POSTFIX_DECREMENT: return object;
 
-  // Nullary operator that results in an arithmetic type.
-  case DECIMAL_LITERAL: {
-    // Check and consume the sign.
-    bool   negative = *evaluated.section.first == '-';
-    String parsed   = createString(
-        (negative || *evaluated.section.first == '+') + evaluated.section.first,
-        evaluated.section.after);
-
-    // Parse the string to a decimal number.
-    Number decimal = parseDecimal(parsed);
-    if (decimal.flag == NUMBER_TOO_PRECISE) {
-      highlightError(
-        context->reported, evaluated.section, "The number is too long!");
-      disposeNumber(&decimal);
-      return false;
-    }
+  // Operator that results in the surrounded object.
+  case GROUP: return operand;
+  default: unexpected("Unknown unary operator!");
+  }
 
-    Object object = {.known = true};
+  // Operand is converted to the type of the operation, as C does.
+  if (operand.known)
+    object.known = foldUnaryOperation(
+      folded.operator, object.type,
+      convertValue(operand.type, object.type, operand.value), &object.value);
+  return object;
+}
 
-    // Default to an int.
-    if (
-      convertNumberToArithmetic(
-        INT_TYPE_INSTANCE, &object.value, decimal, negative) ==
-      NUMBER_CONVERSION_SUCCESS) {
-      object.type = INT_TYPE_INSTANCE;
-    } else {
-      // Otherwise, it is inferred as double, which is always possible.
-      expect(
-        convertNumberToArithmetic(
-          DOUBLE_TYPE_INSTANCE, &object.value, decimal, negative) ==
-          NUMBER_CONVERSION_SUCCESS,
-        "Failed to convert to a double!");
-      object.type = DOUBLE_TYPE_INSTANCE;
-    }
-    pushEvaluationNode(
-      built, (EvaluationNode){.evaluated = evaluated, .object = object});
-    disposeNumber(&decimal);
-    return true;
-  }
-  default: unexpected("Unknown nullary operator!");
-  }
+/* Result of the given shift node on the given operands. Result is known if
+ * both operands are known, and the shift is defined for them. */
+static Object
+foldShiftNode(ExpressionNode folded, Object leftOperand, Object rightOperand) {
+  // C shifts in the promoted type of the left operand, and only promotes the
+  // amount. Then, the result is converted to the combined type of the node.
+  Type   operation = findCombination(leftOperand.type, INT_TYPE_INSTANCE);
+  Type   amount    = findCombination(rightOperand.type, INT_TYPE_INSTANCE);
+  Object object    = {.type = findCombination(operation, amount)};
+  if (!leftOperand.known || !rightOperand.known) return object;
+
+  Value shifted = defaultValue(operation);
+  object.known  = foldShiftOperation(
+     folded.operator, operation,
+     convertValue(leftOperand.type, operation, leftOperand.value), amount,
+     convertValue(rightOperand.type, amount, rightOperand.value), &shifted);
+  if (object.known)
+    object.value = convertValue(operation, object.type, shifted);
+  return object;
 }
 
-/* Version of `evaluateNode` with a prenary operator. */
-static bool evaluatePrenaryNode(
-  Context* context, Evaluation* built, ExpressionNode const** pointer) {
-  ExpressionNode evaluated = **pointer;
-  (*pointer)--;
-  switch (evaluated.operator) {
-  // Prenary operators taking any arithmetic and returning it.
-  case POSATE:
-  case NEGATE: {
-    // Check the operand.
-    if (!evaluateArithmeticNode(context, built, pointer)) return false;
-    EvaluationNode operand = built->after[-1];
-
-    // Do integer promotion.
-    Object object = {
-      .type = findCombination(operand.object.type, INT_TYPE_INSTANCE)};
-    pushEvaluationNode(
-      built, (EvaluationNode){.evaluated = evaluated, .object = object});
-    return true;
-  }
+/* Result of the given binary node, which is not an assignment, on the given
+ * operands. Result is known if both operands are known, and the operation is
+ * defined for them. */
+static Object
+foldBinaryNode(ExpressionNode folded, Object leftOperand, Object rightOperand) {
+  // Find the type the operation is done in, and do integer promotion.
+  Type operation = findCombination(
+    findCombination(leftOperand.type, rightOperand.type), INT_TYPE_INSTANCE);
+  Object object = {.type = operation};
+  switch (folded.operator) {
+  // Binary operators taking any arithmetic or integer and returning it.
+  case MULTIPLICATION:
+  case DIVISION:
+  case REMINDER:
+  case ADDITION:
+  case SUBTRACTION:
+  case BITWISE_AND:
+  case BITWISE_XOR:
+  case BITWISE_OR: break;
 
-  // Prenary operator taking any arithmetic and returning bool.
-  case LOGICAL_NOT: {
-    // Check the operand.
-    if (!evaluateArithmeticNode(context, built, pointer)) return false;
+  // Binary operators that are done in the type of the left operand.
+  case LEFT_SHIFT:
+  case RIGHT_SHIFT: return foldShiftNode(folded, leftOperand, rightOperand);
 
-    // Result is always bool.
-    Object object = {.type = BOOL_TYPE_INSTANCE};
-    pushEvaluationNode(
-      built, (EvaluationNode){.evaluated = evaluated, .object = object});
-    return true;
-  }
+  // Binary operators comparing any arithmetic and returning bool.
+  case SMALLER_THAN:
+  case SMALLER_THAN_OR_EQUAL_TO:
+  case GREATER_THAN:
+  case GREATER_THAN_OR_EQUAL_TO:
+  case EQUAL_TO:
+  case NOT_EQUAL_TO: object.type = BOOL_TYPE_INSTANCE; break;
 
-  // Prenary operator taking any integer and returning it.
-  case COMPLEMENT: {
-    // Check the operand.
-    if (!evaluateIntegerNode(context, built, pointer)) return false;
-    EvaluationNode operand = built->after[-1];
-
-    // Do integer promotion.
-    Object object = {
-      .type = findCombination(operand.object.type, INT_TYPE_INSTANCE)};
-    pushEvaluationNode(
-      built, (EvaluationNode){.evaluated = evaluated, .object = object});
-    return true;
+  // Binary operators taking any arithmetic as bool and returning bool.
+  case LOGICAL_AND:
+  case LOGICAL_OR:
+    operation   = BOOL_TYPE_INSTANCE;
+    object.type = BOOL_TYPE_INSTANCE;
+    break;
+  default: unexpected("Unknown binary operator!");
   }
 
-  // Prenary operators taking any arithmetic and returning void.
+  // Operands are converted to the type of the operation, as C does.
+  if (leftOperand.known && rightOperand.known)
+    object.known = foldBinaryOperation(
+      folded.operator, operation,
+      convertValue(leftOperand.type, operation, leftOperand.value),
+      convertValue(rightOperand.type, operation, rightOperand.value),
+      &object.value);
+  return object;
+}
+
+/* Finish the given checked pending node after its operands. */
+static bool
+leaveCheckedNode(Context* context, Evaluation* built, PendingNode left) {
+  switch (left.analyzed.operator) {
+  // Operators that delegated to their unchecked versions.
+  case LOGICAL_NOT:
   case PREFIX_INCREMENT:
-  case PREFIX_DECREMENT: {
-    // Check the operand.
-    if (!evaluateArithmeticNode(context, built, pointer)) return false;
-
-    // Result is always void.
-    Object object = {.type = VOID_TYPE_INSTANCE};
-    pushEvaluationNode(
-      built, (EvaluationNode){.evaluated = evaluated, .object = object});
-    return true;
+  case PREFIX_DECREMENT:
+  case POSTFIX_INCREMENT:
+  case POSTFIX_DECREMENT:
+  case ASSIGNMENT:
+  case MULTIPLICATION_ASSIGNMENT:
+  case DIVISION_ASSIGNMENT:
+  case REMINDER_ASSIGNMENT:
+  case ADDITION_ASSIGNMENT:
+  case SUBTRACTION_ASSIGNMENT:
+  case LEFT_SHIFT_ASSIGNMENT:
+  case RIGHT_SHIFT_ASSIGNMENT:
+  case BITWISE_AND_ASSIGNMENT:
+  case BITWISE_XOR_ASSIGNMENT:
+  case BITWISE_OR_ASSIGNMENT: return leaveDelegated(built, left);
+
+  // Operators that result in the expected type.
+  default: {
+    if (!left.valid || !left.succeeded) return false;
+
+    // Operands are analyzed from right to left.
+    Object object =
+      getOperator(left.analyzed.operator).tag == OPERATOR_BINARY
+        ? foldBinaryNode(
+            left.analyzed, left.operands[1].object, left.operands[0].object)
+        : foldUnaryNode(left.analyzed, left.operands[0].object);
+    return leaveWithObject(
+      context, built, left, convertObject(object, left.expected));
+  }
   }
+}
+
+/* Enter the given pending node with a prenary operator that is evaluated. */
+static void enterEvaluatedPrenaryNode(PendingNode* entered) {
+  switch (entered->analyzed.operator) {
+  // Prenary operators taking any arithmetic.
+  case POSATE:
+  case NEGATE:
+  case LOGICAL_NOT:
+  case PREFIX_INCREMENT:
+  case PREFIX_DECREMENT:
+    awaitOperands(entered, 1, ANALYSIS_EVALUATE_ARITHMETIC);
+    break;
+
+  // Prenary operator taking any integer.
+  case COMPLEMENT: awaitOperands(entered, 1, ANALYSIS_EVALUATE_INTEGER); break;
   default: unexpected("Unknown prenary operator!");
   }
 }
 
-/* Version of `evaluateNode` with a postary operator. */
-static bool evaluatePostaryNode(
-  Context* context, Evaluation* built, ExpressionNode const** pointer) {
-  ExpressionNode evaluated = **pointer;
-  (*pointer)--;
-  switch (evaluated.operator) {
-  // Postary operators taking any arithmetic and returning void.
+/* Enter the given pending node with a postary operator that is evaluated. */
+static void enterEvaluatedPostaryNode(PendingNode* entered) {
+  switch (entered->analyzed.operator) {
+  // Postary operators taking any arithmetic.
   case POSTFIX_INCREMENT:
-  case POSTFIX_DECREMENT: {
-    // Check the operand.
-    if (!evaluateArithmeticNode(context, built, pointer)) return false;
-
-    // Result is always void.
-    Object object = {.type = VOID_TYPE_INSTANCE};
-    pushEvaluationNode(
-      built, (EvaluationNode){.evaluated = evaluated, .object = object});
-    return true;
-  }
+  case POSTFIX_DECREMENT:
+    awaitOperands(entered, 1, ANALYSIS_EVALUATE_ARITHMETIC);
+    break;
   default: unexpected("Unknown postary operator!");
   }
 }
 
-/* Version of `evaluateNode` with a cirnary operator. */
-static bool evaluateCirnaryNode(
-  Context* context, Evaluation* built, ExpressionNode const** pointer) {
-  ExpressionNode evaluated = **pointer;
-  (*pointer)--;
-  switch (evaluated.operator) {
-  // Cirnary operator taking any type and returning it.
-  case GROUP: {
-    // Check the operand.
-    if (!evaluateNode(context, built, pointer)) return false;
-    EvaluationNode operand = built->after[-1];
-
-    // Create with the the surrounded object.
-    pushEvaluationNode(
-      built,
-      (EvaluationNode){.evaluated = evaluated, .object = operand.object});
-    return true;
-  }
+/* Enter the given pending node with a cirnary operator that is evaluated. */
+static void enterEvaluatedCirnaryNode(PendingNode* entered) {
+  switch (entered->analyzed.operator) {
+  // Cirnary operator taking any type.
+  case GROUP: awaitOperands(entered, 1, ANALYSIS_EVALUATE); break;
   default: unexpected("Unknown cirnary operator!");
   }
 }
 
-/* Version of `evaluateNode` with a binary operator. */
-static bool evaluateBinaryNode(
-  Context* context, Evaluation* built, ExpressionNode const** pointer) {
-  ExpressionNode evaluated = **pointer;
-  (*pointer)--;
-  switch (evaluated.operator) {
-  // Binary operators taking any arithmetic and returning it.
+/* Enter the given pending node with a binary operator that is evaluated. */
+static void enterEvaluatedBinaryNode(PendingNode* entered) {
+  switch (entered->analyzed.operator) {
+  // Binary operators taking any arithmetic.
   case MULTIPLICATION:
   case DIVISION:
   case REMINDER:
   case ADDITION:
-  case SUBTRACTION: {
-    // Store the result for reporting multiple errors.
-    bool result = true;
-
-    // Check the operands.
-    EvaluationNode leftOperand;
-    EvaluationNode rightOperand;
-    if (!evaluateArithmeticNode(context, built, pointer)) result = false;
-    else rightOperand = built->after[-1];
-    if (!evaluateArithmeticNode(context, built, pointer)) result = false;
-    else leftOperand = built->after[-1];
-    if (!result) return false;
-
-    // Find the resultant type.
-    Object object = {
-      .type =
-        findCombination(leftOperand.object.type, rightOperand.object.type)};
-
-    // Do integer promotion.
-    object.type = findCombination(object.type, INT_TYPE_INSTANCE);
-    pushEvaluationNode(
-      built, (EvaluationNode){.evaluated = evaluated, .object = object});
-    return true;
-  }
+  case SUBTRACTION:
+  case SMALLER_THAN:
+  case SMALLER_THAN_OR_EQUAL_TO:
+  case GREATER_THAN:
+  case GREATER_THAN_OR_EQUAL_TO:
+  case EQUAL_TO:
+  case NOT_EQUAL_TO:
+  case LOGICAL_AND:
+  case LOGICAL_OR:
+  case MULTIPLICATION_ASSIGNMENT:
+  case DIVISION_ASSIGNMENT:
+  case REMINDER_ASSIGNMENT:
+  case ADDITION_ASSIGNMENT:
+  case SUBTRACTION_ASSIGNMENT:
+    awaitOperands(entered, 2, ANALYSIS_EVALUATE_ARITHMETIC);
+    break;
 
-  // Binary operators taking any integer and returning it.
+  // Binary operators taking any integer.
   case LEFT_SHIFT:
   case RIGHT_SHIFT:
   case BITWISE_AND:
   case BITWISE_XOR:
-  case BITWISE_OR: {
-    // Store the result for reporting multiple errors.
-    bool result = true;
-
-    // Check the operands.
-    EvaluationNode leftOperand;
-    EvaluationNode rightOperand;
-    if (!evaluateIntegerNode(context, built, pointer)) result = false;
-    else rightOperand = built->after[-1];
-    if (!evaluateIntegerNode(context, built, pointer)) result = false;
-    else leftOperand = built->after[-1];
-    if (!result) return false;
+  case BITWISE_OR:
+  case LEFT_SHIFT_ASSIGNMENT:
+  case RIGHT_SHIFT_ASSIGNMENT:
+  case BITWISE_AND_ASSIGNMENT:
+  case BITWISE_XOR_ASSIGNMENT:
+  case BITWISE_OR_ASSIGNMENT:
+    awaitOperands(entered, 2, ANALYSIS_EVALUATE_INTEGER);
+    break;
 
-    // Find the resultant type.
-    Object object = {
-      .type =
-        findCombination(leftOperand.object.type, rightOperand.object.type)};
+  // Binary operator taking any type.
+  case ASSIGNMENT: awaitOperands(entered, 2, ANALYSIS_EVALUATE); break;
+  default: unexpected("Unknown binary operator!");
+  }
+}
 
-    // Do integer promotion.
-    object.type = findCombination(object.type, INT_TYPE_INSTANCE);
-    pushEvaluationNode(
-      built, (EvaluationNode){.evaluated = evaluated, .object = object});
-    return true;
+/* Enter the given pending node that is evaluated. */
+static void
+enterEvaluatedNode(Context* context, Evaluation* built, PendingNode* entered) {
+  switch (getOperator(entered->analyzed.operator).tag) {
+  case OPERATOR_NULLARY:
+    finishEntered(
+      entered, evaluateNullaryNode(context, built, entered->analyzed));
+    break;
+  case OPERATOR_PRENARY: enterEvaluatedPrenaryNode(entered); break;
+  case OPERATOR_POSTARY: enterEvaluatedPostaryNode(entered); break;
+  case OPERATOR_CIRNARY: enterEvaluatedCirnaryNode(entered); break;
+  case OPERATOR_BINARY: enterEvaluatedBinaryNode(entered); break;
+  case OPERATOR_VARIARY:
+    finishEntered(
+      entered, evaluateVariaryNode(context, built, entered->analyzed));
+    break;
+  default: unexpected("Unknown operator variant!");
   }
+}
 
-  // Binary operators taking any arithmetic and returning bool.
+/* Finish the given evaluated pending node with a prenary, postary or cirnary
+ * operator after its operand. */
+static bool
+leaveEvaluatedUnaryNode(Context* context, Evaluation* built, PendingNode left) {
+  if (!left.succeeded) return false;
+  return leaveWithObject(
+    context, built, left,
+    foldUnaryNode(left.analyzed, left.operands[0].object));
+}
+
+/* Finish the given evaluated pending node with a binary operator after its
+ * operands. */
+static bool leaveEvaluatedBinaryNode(
+  Context* context, Evaluation* built, PendingNode left) {
+  if (!left.succeeded) return false;
+
+  // Operands are analyzed from right to left.
+  EvaluationNode rightOperand = left.operands[0];
+  EvaluationNode leftOperand  = left.operands[1];
+
+  // Find the resultant type, and do integer promotion.
+  Object combined = {
+    .type = findCombination(
+      findCombination(leftOperand.object.type, rightOperand.object.type),
+      INT_TYPE_INSTANCE)};
+  Object voided = {.type = VOID_TYPE_INSTANCE};
+
+  switch (left.analyzed.operator) {
+  // Binary operators that calculate a value, which might be known.
+  case MULTIPLICATION:
+  case DIVISION:
+  case REMINDER:
+  case ADDITION:
+  case SUBTRACTION:
+  case LEFT_SHIFT:
+  case RIGHT_SHIFT:
+  case BITWISE_AND:
+  case BITWISE_XOR:
+  case BITWISE_OR:
   case SMALLER_THAN:
   case SMALLER_THAN_OR_EQUAL_TO:
   case GREATER_THAN:
@@ -909,177 +1094,172 @@ static bool evaluateBinaryNode(
   case EQUAL_TO:
   case NOT_EQUAL_TO:
   case LOGICAL_AND:
-  case LOGICAL_OR: {
-    // Check the operands.
-    // Bitwise OR to report multiple errors.
-    if (
-      (int)!evaluateArithmeticNode(context, built, pointer) |
-      !evaluateArithmeticNode(context, built, pointer))
-      return false;
-
-    // Result is always bool.
-    Object object = {.type = BOOL_TYPE_INSTANCE};
-    pushEvaluationNode(
-      built, (EvaluationNode){.evaluated = evaluated, .object = object});
-    return true;
-  }
+  case LOGICAL_OR:
+    return leaveWithObject(
+      context, built, left,
+      foldBinaryNode(left.analyzed, leftOperand.object, rightOperand.object));
 
   // Binary operator taking any type and returning void.
-  case ASSIGNMENT: {
-    // Store the result for reporting multiple errors.
-    bool result = true;
-
-    // Check the operands.
-    EvaluationNode leftOperand;
-    EvaluationNode rightOperand;
-    if (!evaluateNode(context, built, pointer)) result = false;
-    else rightOperand = built->after[-1];
-    if (!evaluateNode(context, built, pointer)) result = false;
-    else leftOperand = built->after[-1];
-    if (!result) return false;
-
-    // Check assignment.
+  case ASSIGNMENT:
     if (!checkAssignment(
-          context, rightOperand.evaluated.section, rightOperand.object,
-          leftOperand))
+          context, findNodeSection(context, rightOperand.evaluated),
+          rightOperand.object, leftOperand))
       return false;
+    return leaveWithObject(context, built, left, voided);
 
-    // Result is always void.
-    Object object = {.type = VOID_TYPE_INSTANCE};
-    pushEvaluationNode(
-      built, (EvaluationNode){.evaluated = evaluated, .object = object});
-    return true;
-  }
-
-  // Binary operators taking any arithmetic and returning void.
+  // Binary operators taking any arithmetic or integer and returning void.
   case MULTIPLICATION_ASSIGNMENT:
   case DIVISION_ASSIGNMENT:
   case REMINDER_ASSIGNMENT:
   case ADDITION_ASSIGNMENT:
-  case SUBTRACTION_ASSIGNMENT: {
-    // Store the result for reporting multiple errors.
-    bool result = true;
-
-    // Check the operands.
-    EvaluationNode leftOperand;
-    EvaluationNode rightOperand;
-    if (!evaluateArithmeticNode(context, built, pointer)) result = false;
-    else rightOperand = built->after[-1];
-    if (!evaluateArithmeticNode(context, built, pointer)) result = false;
-    else leftOperand = built->after[-1];
-    if (!result) return false;
-
-    // Build assigned object and check.
-    Object assigned = {
-      .type =
-        findCombination(leftOperand.object.type, rightOperand.object.type)};
-
-    // Do integer promotion.
-    assigned.type = findCombination(assigned.type, INT_TYPE_INSTANCE);
-    if (!checkAssignment(
-          context, rightOperand.evaluated.section, assigned, leftOperand))
-      return false;
-
-    // Result is always void.
-    Object object = {.type = VOID_TYPE_INSTANCE};
-    pushEvaluationNode(
-      built, (EvaluationNode){.evaluated = evaluated, .object = object});
-    return true;
-  }
-
-  // Binary operators taking any integer and returning void.
+  case SUBTRACTION_ASSIGNMENT:
   case LEFT_SHIFT_ASSIGNMENT:
   case RIGHT_SHIFT_ASSIGNMENT:
   case BITWISE_AND_ASSIGNMENT:
   case BITWISE_XOR_ASSIGNMENT:
-  case BITWISE_OR_ASSIGNMENT: {
-    // Store the result for reporting multiple errors.
-    bool result = true;
-
-    // Check the operands.
-    EvaluationNode leftOperand;
-    EvaluationNode rightOperand;
-    if (!evaluateIntegerNode(context, built, pointer)) result = false;
-    else rightOperand = built->after[-1];
-    if (!evaluateIntegerNode(context, built, pointer)) result = false;
-    else leftOperand = built->after[-1];
-    if (!result) return false;
-
-    // Build assigned object and check.
-    Object assigned = {
-      .type =
-        findCombination(leftOperand.object.type, rightOperand.object.type)};
-
-    // Do integer promotion.
-    assigned.type = findCombination(assigned.type, INT_TYPE_INSTANCE);
+  case BITWISE_OR_ASSIGNMENT:
     if (!checkAssignment(
-          context, rightOperand.evaluated.section, assigned, leftOperand))
+          context, findNodeSection(context, rightOperand.evaluated), combined,
+          leftOperand))
       return false;
-
-    // Result is always void.
-    Object object = {.type = VOID_TYPE_INSTANCE};
-    pushEvaluationNode(
-      built, (EvaluationNode){.evaluated = evaluated, .object = object});
-    return true;
-  }
+    return leaveWithObject(context, built, left, voided);
   default: unexpected("Unknown binary operator!");
   }
 }
 
-/* Version of `evaluateNode` with a variary operator. */
-static bool evaluateVariaryNode(
-  Context* context, Evaluation* built, ExpressionNode const** pointer) {
-  ExpressionNode evaluated = **pointer;
+/* Finish the given evaluated pending node after its operands. */
+static bool
+leaveEvaluatedNode(Context* context, Evaluation* built, PendingNode left) {
+  switch (getOperator(left.analyzed.operator).tag) {
+  case OPERATOR_PRENARY:
+  case OPERATOR_POSTARY:
+  case OPERATOR_CIRNARY: return leaveEvaluatedUnaryNode(context, built, left);
+  case OPERATOR_BINARY: return leaveEvaluatedBinaryNode(context, built, left);
+  default: unexpected("Operator variant does not have operands!");
+  }
+}
+
+/* Start analyzing the node at the given pointer in the given way by pushing it
+ * to the pending nodes, and move the pointer to the node before it. */
+static void enterNode(
+  Context* context, Evaluation* built, ExpressionNode const** pointer,
+  Analysis analysis, Type expected) {
+  // Even if the expected type is not an integer, the checked node should be.
+  if (analysis == ANALYSIS_CHECK_INTEGER)
+    analysis =
+      checkIntegerness(expected) ? ANALYSIS_CHECK : ANALYSIS_EVALUATE_INTEGER;
+
+  pushPendingNode(
+    context, (PendingNode){
+               .analyzed  = **pointer,
+               .analysis  = analysis,
+               .expected  = expected,
+               .pending   = 0,
+               .returned  = 0,
+               .valid     = true,
+               .succeeded = true,
+               .finished  = false});
   (*pointer)--;
-  switch (evaluated.operator) {
-  case FUNCTION_CALL:
-    highlightWarning(
-      context->reported, evaluated.section,
-      "Function call is not implemented.");
-    return false;
-  default: unexpected("Unknown variary operator!");
+
+  PendingNode* entered = context->pending.after - 1;
+  if (analysis == ANALYSIS_CHECK)
+    enterCheckedNode(context, built, pointer, entered);
+  else enterEvaluatedNode(context, built, entered);
+}
+
+/* Finish analyzing the given pending node. Returns whether the analysis was
+ * successful. */
+static bool leaveNode(Context* context, Evaluation* built, PendingNode left) {
+  bool result = left.valid;
+  if (!left.finished) {
+    result = left.analysis == ANALYSIS_CHECK
+             ? leaveCheckedNode(context, built, left)
+             : leaveEvaluatedNode(context, built, left);
+  }
+  if (!result) return false;
+
+  // Check the type of the result if the analysis requires it.
+  switch (left.analysis) {
+  case ANALYSIS_EVALUATE_ARITHMETIC:
+    return checkArithmeticResult(context, built);
+  case ANALYSIS_EVALUATE_INTEGER: return checkIntegerResult(context, built);
+  default: return true;
   }
 }
 
-/* Evaluate the given expression node and move it to the node that comes after
- * the given one and its childeren. Returns whether the evaluation failed. */
-static bool evaluateNode(
-  Context* context, Evaluation* built, ExpressionNode const** pointer) {
-  ExpressionNode evaluated = **pointer;
-  switch (getOperator(evaluated.operator).tag) {
-  case OPERATOR_NULLARY: return evaluateNullaryNode(context, built, pointer);
-  case OPERATOR_PRENARY: return evaluatePrenaryNode(context, built, pointer);
-  case OPERATOR_POSTARY: return evaluatePostaryNode(context, built, pointer);
-  case OPERATOR_CIRNARY: return evaluateCirnaryNode(context, built, pointer);
-  case OPERATOR_BINARY: return evaluateBinaryNode(context, built, pointer);
-  case OPERATOR_VARIARY: return evaluateVariaryNode(context, built, pointer);
-  default: unexpected("Unknown operator variant!");
+/* Analyze the node at the given pointer in the given way and build it into the
+ * given evaluation. Nodes whose operands are being analyzed are kept in the
+ * pending nodes instead of the call stack; thus, the depth of nesting only
+ * costs memory. Returns whether the analysis was successful. */
+static bool analyzeNode(
+  Context* context, Evaluation* built, ExpressionNode const* pointer,
+  Analysis analysis, Type expected) {
+  size_t base = countPendingNodes(context);
+  enterNode(context, built, &pointer, analysis, expected);
+
+  while (true) {
+    // Enter the next operand of the top node if it waits for one. Operands are
+    // entered from right to left, as the pointer goes backwards.
+    PendingNode* top = context->pending.after - 1;
+    if (!top->finished && top->pending) {
+      top->pending--;
+      enterNode(context, built, &pointer, top->operandAnalysis, top->expected);
+      continue;
+    }
+
+    // Otherwise, the top node is complete. Give its result to the node that
+    // waits for it, or return the result if it is the analyzed one.
+    bool result = leaveNode(context, built, *top);
+    context->pending.after--;
+    if (countPendingNodes(context) == base) return result;
+
+    PendingNode* waiting = context->pending.after - 1;
+    if (result) waiting->operands[waiting->returned] = built->after[-1];
+    else waiting->succeeded = false;
+    waiting->returned++;
   }
 }
 
+/* Evaluate the given expression and build it into the given evaluation; and
+ * check its type. Returns whether the expression was successful and the
+ * expression had the expected type. */
+static bool checkExpression(
+  Context* context, Evaluation* built, Expression checked, Type expected) {
+  // Check starting from the root node.
+  return analyzeNode(
+    context, built, getExpressionRoot(context->analyzed, checked),
+    ANALYSIS_CHECK, expected);
+}
+
 /* Evaluate the given expression and build it into the given evaluation. Returns
  * whether the expression was successful. */
 static bool
 evaluateExpression(Context* context, Evaluation* built, Expression evaluated) {
-  // Evaluate starting from the root node.
-  ExpressionNode const* start = evaluated.after - 1;
-  return evaluateNode(context, built, &start);
+  // Evaluate starting from the root node. Expected type is not used.
+  return analyzeNode(
+    context, built, getExpressionRoot(context->analyzed, evaluated),
+    ANALYSIS_EVALUATE, VOID_TYPE_INSTANCE);
 }
 
 /* Evaluate the type in the given expression and build it into the given type.
  * Returns whether the expression is correct and the type of the given
  * expression is the meta type. */
 static bool evaluateType(Context* context, Type* built, Expression resolved) {
-  // Evaluate the type expression and expect the meta type.
-  Evaluation evaluation = createEvaluation(0);
-  if (!checkExpression(context, &evaluation, resolved, META_TYPE_INSTANCE))
+  // Evaluate the type expression and expect the meta type. Evaluation is only
+  // needed until its value is found; thus, it is released right away, which
+  // gives its memory back as it is the most recent one in the table.
+  Evaluation evaluation = createEvaluation(&context->target->evaluations, 0);
+  if (!checkExpression(context, &evaluation, resolved, META_TYPE_INSTANCE)) {
+    disposeEvaluation(&context->target->evaluations, &evaluation);
     return false;
+  }
+  Object evaluated = evaluation.after[-1].object;
+  disposeEvaluation(&context->target->evaluations, &evaluation);
 
   // Check whether the value, which is the type, is known.
-  Object evaluated = evaluation.after[-1].object;
   if (!evaluated.known) {
     highlightError(
-      context->reported, getExpressionSection(resolved),
+      context->reported, getExpressionSection(context->analyzed, resolved),
       "Type must be known at compile-time!");
     return false;
   }
@@ -1120,31 +1300,34 @@ checkVariableType(Context* context, Type checked, String highlighted) {
   return true;
 }
 
-/* Add the given name to the failed definitions. */
-static void recordFailedDefinition(Context* context, String name) {
-  insertMember(&context->failedNames, name);
+/* Add the given name with its interned identifier to the failed
+ * definitions. */
+static void
+recordFailedDefinition(Context* context, String name, uint32_t identifier) {
+  accessName(context, identifier)->failed = name;
 }
 
 /* Resolve the given binding definition. */
 static void
 resolveBindingDefinition(Context* context, BindingDefinition resolved) {
   // Check name.
-  if (!checkDefinedName(context, resolved.name)) return;
+  if (!checkDefinedName(context, resolved.name, resolved.identifier)) return;
 
   // Check type.
   Type definedType;
   if (
     !evaluateType(context, &definedType, resolved.type) ||
     !checkBindingType(
-      context, definedType, getExpressionSection(resolved.type))) {
-    recordFailedDefinition(context, resolved.name);
+      context, definedType,
+      getExpressionSection(context->analyzed, resolved.type))) {
+    recordFailedDefinition(context, resolved.name, resolved.identifier);
     return;
   }
 
   // Check value.
-  Evaluation definedValue = createEvaluation(0);
+  Evaluation definedValue = createEvaluation(&context->target->evaluations, 0);
   if (!checkExpression(context, &definedValue, resolved.value, definedType)) {
-    recordFailedDefinition(context, resolved.name);
+    recordFailedDefinition(context, resolved.name, resolved.identifier);
     return;
   }
 
@@ -1156,59 +1339,62 @@ resolveBindingDefinition(Context* context, BindingDefinition resolved) {
              .value = root.object.value,
              .known = root.object.known};
   addSymbol(
-    context, (Symbol){
-               .asBinding   = binding,
-               .tag         = SYMBOL_BINDING,
-               .name        = resolved.name,
-               .object      = object,
-               .userDefined = true});
+    context, resolved.identifier,
+    (Symbol){
+      .asBinding   = binding,
+      .tag         = SYMBOL_BINDING,
+      .name        = resolved.name,
+      .object      = object,
+      .userDefined = true});
 }
 
 /* Resolve the given inferred binding definition. */
 static void resolveInferredBindingDefinition(
   Context* context, InferredBindingDefinition resolved) {
   // Check name.
-  if (!checkDefinedName(context, resolved.name)) return;
+  if (!checkDefinedName(context, resolved.name, resolved.identifier)) return;
 
   // Check value.
-  Evaluation definedValue = createEvaluation(0);
+  Evaluation definedValue = createEvaluation(&context->target->evaluations, 0);
   if (!evaluateExpression(context, &definedValue, resolved.value)) {
-    recordFailedDefinition(context, resolved.name);
+    recordFailedDefinition(context, resolved.name, resolved.identifier);
     return;
   }
 
   // Create a symbol with the given value.
   Binding binding = {.bound = definedValue};
   addSymbol(
-    context, (Symbol){
-               .asBinding   = binding,
-               .tag         = SYMBOL_BINDING,
-               .name        = resolved.name,
-               .object      = definedValue.after[-1].object,
-               .userDefined = true});
+    context, resolved.identifier,
+    (Symbol){
+      .asBinding   = binding,
+      .tag         = SYMBOL_BINDING,
+      .name        = resolved.name,
+      .object      = definedValue.after[-1].object,
+      .userDefined = true});
 }
 
 /* Resolve the given variable definition. */
 static void
 resolveVariableDefinition(Context* context, VariableDefinition resolved) {
   // Check name.
-  if (!checkDefinedName(context, resolved.name)) return;
+  if (!checkDefinedName(context, resolved.name, resolved.identifier)) return;
 
   // Check type.
   Type definedType;
   if (
     !evaluateType(context, &definedType, resolved.type) ||
     !checkVariableType(
-      context, definedType, getExpressionSection(resolved.type))) {
-    recordFailedDefinition(context, resolved.name);
+      context, definedType,
+      getExpressionSection(context->analyzed, resolved.type))) {
+    recordFailedDefinition(context, resolved.name, resolved.identifier);
     return;
   }
 
   // Check value.
-  Evaluation definedValue = createEvaluation(0);
+  Evaluation definedValue = createEvaluation(&context->target->evaluations, 0);
   if (!checkExpression(
         context, &definedValue, resolved.initialValue, definedType)) {
-    recordFailedDefinition(context, resolved.name);
+    recordFailedDefinition(context, resolved.name, resolved.identifier);
     return;
   }
 
@@ -1220,52 +1406,55 @@ resolveVariableDefinition(Context* context, VariableDefinition resolved) {
               .value = root.object.value,
               .known = root.object.known};
   addSymbol(
-    context, (Symbol){
-               .asVariable  = variable,
-               .tag         = SYMBOL_VARIABLE,
-               .name        = resolved.name,
-               .object      = object,
-               .userDefined = true});
+    context, resolved.identifier,
+    (Symbol){
+      .asVariable  = variable,
+      .tag         = SYMBOL_VARIABLE,
+      .name        = resolved.name,
+      .object      = object,
+      .userDefined = true});
 }
 
 /* Resolve the given inferred variable definition. */
 static void resolveInferredVariableDefinition(
   Context* context, InferredVariableDefinition resolved) {
   // Check name.
-  if (!checkDefinedName(context, resolved.name)) return;
+  if (!checkDefinedName(context, resolved.name, resolved.identifier)) return;
 
   // Check value.
-  Evaluation definedValue = createEvaluation(0);
+  Evaluation definedValue = createEvaluation(&context->target->evaluations, 0);
   if (!evaluateExpression(context, &definedValue, resolved.initialValue)) {
-    recordFailedDefinition(context, resolved.name);
+    recordFailedDefinition(context, resolved.name, resolved.identifier);
     return;
   }
 
   // Create a symbol with the given value.
   Variable variable = {.initial = definedValue, .defaulted = false};
   addSymbol(
-    context, (Symbol){
-               .asVariable  = variable,
-               .tag         = SYMBOL_VARIABLE,
-               .name        = resolved.name,
-               .object      = definedValue.after[-1].object,
-               .userDefined = true});
+    context, resolved.identifier,
+    (Symbol){
+      .asVariable  = variable,
+      .tag         = SYMBOL_VARIABLE,
+      .name        = resolved.name,
+      .object      = definedValue.after[-1].object,
+      .userDefined = true});
 }
 
 /* Resolve the given defaulted variable definition. */
 static void resolveDefaultedVariableDefinition(
   Context* context, DefaultedVariableDefinition resolved) {
   // Check name.
-  if (!checkDefinedName(context, resolved.name)) return;
+  if (!checkDefinedName(context, resolved.name, resolved.identifier)) return;
 
   // Check type.
   Type definedType;
   if (
     !evaluateType(context, &definedType, resolved.type) ||
     !checkVariableType(
-      context, definedType, getExpressionSection(resolved.type)) ||
+      context, definedType,
+      getExpressionSection(context->analyzed, resolved.type)) ||
     !checkDefaultability(definedType)) {
-    recordFailedDefinition(context, resolved.name);
+    recordFailedDefinition(context, resolved.name, resolved.identifier);
     return;
   }
 
@@ -1274,25 +1463,28 @@ static void resolveDefaultedVariableDefinition(
   Object   object   = {
         .type = definedType, .value = defaultValue(definedType), .known = true};
   addSymbol(
-    context, (Symbol){
-               .asVariable  = variable,
-               .tag         = SYMBOL_VARIABLE,
-               .name        = resolved.name,
-               .object      = object,
-               .userDefined = true});
+    context, resolved.identifier,
+    (Symbol){
+      .asVariable  = variable,
+      .tag         = SYMBOL_VARIABLE,
+      .name        = resolved.name,
+      .object      = object,
+      .userDefined = true});
 }
 
 /* Resolve the given discarded expression. */
 static void
 resolveDiscardedExpression(Context* context, DiscardedExpression resolved) {
-  // Check the discarded expression.
-  Evaluation discarded = createEvaluation(0);
-  if (!checkExpression(
-        context, &discarded, resolved.discarded, VOID_TYPE_INSTANCE))
-    return;
+  // Check the discarded expression, whose evaluation is not kept.
+  Evaluation discarded = createEvaluation(&context->target->evaluations, 0);
+  bool       checked   = checkExpression(
+            context, &discarded, resolved.discarded, VOID_TYPE_INSTANCE);
+  disposeEvaluation(&context->target->evaluations, &discarded);
+  if (!checked) return;
 
   highlightWarning(
-    context->reported, getExpressionSection(resolved.discarded),
+    context->reported,
+    getExpressionSection(context->analyzed, resolved.discarded),
     "Expression statement in the global scope is skipped.");
 }
 
@@ -1334,14 +1526,27 @@ void analyze(Context* context) {
   resolve(context);
 }
 
-void analyzeParse(Table* target, Source* reported, Parse analyzed) {
-  // Create a context and pass its pointer, because all functions take a context
-  // pointer and this removes the need for taking the adress of the context in
-  // the main anaylsis function.
-  analyze(&(Context){
-    .target         = target,
-    .reported       = reported,
-    .analyzed       = analyzed,
-    .namesToIndices = createMap(0),
-    .failedNames    = createSet(0)});
+void analyzeParse(
+  Table* target, Source* reported, Parse analyzed, bool verbose) {
+  Context context = {
+    .target    = target,
+    .reported  = reported,
+    .analyzed  = analyzed,
+    .names     = {.first = NULL, .after = NULL, .bound = NULL},
+    .slots     = NULL,
+    .slotCount = 0,
+    .pending   = {.first = NULL, .after = NULL, .bound = NULL},
+    .literals  = createLiteralCache(),
+    .scratch   = createArena()
+  };
+  analyze(&context);
+
+  if (verbose && context.literals.lookups)
+    reportInfo(
+      reported, "Literal cache hit %zu of %zu lookups (%.1f%%).",
+      context.literals.hits, context.literals.lookups,
+      100.0 * (double)context.literals.hits / (double)context.literals.lookups);
+
+  disposeLiteralCache(&context.literals);
+  disposeArena(&context.scratch);
 }
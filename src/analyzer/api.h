@@ -4,6 +4,7 @@
 #pragma once
 
 #include "parser/api.h"
+#include "utility/api.h"
 
 #include <stdbool.h>
 #include <stddef.h>
@@ -135,9 +136,15 @@ typedef struct {
   Symbol* after;
   /* Pointer to one after the last allocated symbol. */
   Symbol* bound;
+  /* Memory of the evaluations of the symbols, which are released at once with
+   * the table. */
+  Arena   evaluations;
 } Table;
 
-/* Analyze the given parse. Reports to the given source. */
-Table createTable(Source* reported, Parse analyzed);
+/* Initialize the module. */
+void  initAnalyzer(void);
+/* Analyze the given parse. Reports to the given source, which includes the
+ * statistics of the analysis if it is verbose. */
+Table createTable(Source* reported, Parse analyzed, bool verbose);
 /* Release the memory used by the given table. */
 void  disposeTable(Table* disposed);
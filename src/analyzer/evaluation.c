@@ -8,19 +8,21 @@
 #include <stddef.h>
 #include <stdlib.h>
 
-Evaluation createEvaluation(size_t initialCapacity) {
+Evaluation createEvaluation(Arena* arena, size_t initialCapacity) {
   Evaluation created = {.first = NULL, .after = NULL, .bound = NULL};
-  reserveArray(&created, initialCapacity, EvaluationNode);
+  reserveArenaArray(arena, &created, initialCapacity, EvaluationNode);
   return created;
 }
 
-void disposeEvaluation(Evaluation* disposed) {
-  disposed->first = allocateArray(disposed->first, 0, EvaluationNode);
+void disposeEvaluation(Arena* arena, Evaluation* disposed) {
+  disposed->first =
+    allocateArenaArray(arena, disposed->first, 0, EvaluationNode);
   disposed->after = disposed->first;
   disposed->bound = disposed->first;
 }
 
-void pushEvaluationNode(Evaluation* target, EvaluationNode pushed) {
-  reserveArray(target, 1, EvaluationNode);
+void pushEvaluationNode(
+  Arena* arena, Evaluation* target, EvaluationNode pushed) {
+  reserveArenaArray(arena, target, 1, EvaluationNode);
   *target->after++ = pushed;
 }
@@ -0,0 +1,247 @@
+// FileCopyrightText: 2022 Cem Geçgel <gecgelcem@outlook.com>
+// License-Identifier: GPL-3.0-or-later
+
+#include "analyzer/api.h"
+#include "analyzer/mod.h"
+#include "parser/api.h"
+#include "utility/api.h"
+
+#include <limits.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* Amount of bits in an int. */
+#define INT_WIDTH_BITS (sizeof(int) * CHAR_BIT)
+/* Amount of bits in an uxs. */
+#define UXS_WIDTH_BITS (sizeof(size_t) * CHAR_BIT)
+
+/* Fold the given prenary operator on the given int. */
+static bool foldIntUnary(size_t folded, int operand, Value* target) {
+  switch (folded) {
+  case POSATE: target->asInt = operand; return true;
+  case NEGATE:
+    // Negating the smallest int overflows.
+    if (operand == INT_MIN) return false;
+    target->asInt = -operand;
+    return true;
+  case COMPLEMENT: target->asInt = ~operand; return true;
+  default: unexpected("Unknown unary operator!");
+  }
+}
+
+/* Fold the given prenary operator on the given uxs. */
+static bool foldUxsUnary(size_t folded, size_t operand, Value* target) {
+  switch (folded) {
+  case POSATE: target->asUxs = operand; return true;
+  // Unsigned arithmetic wraps around.
+  case NEGATE: target->asUxs = -operand; return true;
+  case COMPLEMENT: target->asUxs = ~operand; return true;
+  default: unexpected("Unknown unary operator!");
+  }
+}
+
+bool foldUnaryOperation(
+  size_t folded, Type operation, Value operand, Value* target) {
+  switch (operation.tag) {
+  case TYPE_BOOL:
+    expect(folded == LOGICAL_NOT, "Only logical not is done on bool!");
+    target->asBool = !operand.asBool;
+    return true;
+  case TYPE_INT: return foldIntUnary(folded, operand.asInt, target);
+  case TYPE_UXS: return foldUxsUnary(folded, operand.asUxs, target);
+  case TYPE_FLOAT:
+    target->asFloat = folded == NEGATE ? -operand.asFloat : operand.asFloat;
+    return true;
+  case TYPE_DOUBLE:
+    target->asDouble = folded == NEGATE ? -operand.asDouble : operand.asDouble;
+    return true;
+  case TYPE_BYTE: unexpected("Byte is promoted before an operation!");
+  case TYPE_META:
+  case TYPE_VOID: unexpected("Not an arithmetic type!");
+  default: unexpected("Unknown type variant!");
+  }
+}
+
+/* Fold the given operator on the given operands into the given target, and
+ * return from the caller if the operator is a comparison. */
+#define foldComparison(folded, left, right, target)                     \
+  switch (folded) {                                                     \
+  case SMALLER_THAN: (target)->asBool = (left) < (right); return true;  \
+  case SMALLER_THAN_OR_EQUAL_TO:                                        \
+    (target)->asBool = (left) <= (right);                               \
+    return true;                                                        \
+  case GREATER_THAN: (target)->asBool = (left) > (right); return true;  \
+  case GREATER_THAN_OR_EQUAL_TO:                                        \
+    (target)->asBool = (left) >= (right);                               \
+    return true;                                                        \
+  case EQUAL_TO: (target)->asBool = (left) == (right); return true;     \
+  case NOT_EQUAL_TO: (target)->asBool = (left) != (right); return true; \
+  default: break;                                                       \
+  }
+
+/* Fold the given binary operator on the given ints. */
+static bool foldIntBinary(size_t folded, int left, int right, Value* target) {
+  foldComparison(folded, left, right, target);
+
+  // Calculate in a wider type to find the overflows, which are undefined.
+  // Division overflows when the smallest int is divided by minus one.
+  int64_t wide = 0;
+  switch (folded) {
+  case MULTIPLICATION: wide = (int64_t)left * right; break;
+  case DIVISION:
+    if (!right || (left == INT_MIN && right == -1)) return false;
+    wide = left / right;
+    break;
+  case REMINDER:
+    if (!right || (left == INT_MIN && right == -1)) return false;
+    wide = left % right;
+    break;
+  case ADDITION: wide = (int64_t)left + right; break;
+  case SUBTRACTION: wide = (int64_t)left - right; break;
+
+  // Shifting negative numbers or by too many bits is not defined.
+  case LEFT_SHIFT:
+    if (left < 0 || right < 0 || (size_t)right >= INT_WIDTH_BITS) return false;
+    wide = (int64_t)left << right;
+    break;
+  case RIGHT_SHIFT:
+    if (left < 0 || right < 0 || (size_t)right >= INT_WIDTH_BITS) return false;
+    wide = left >> right;
+    break;
+  case BITWISE_AND: wide = left & right; break;
+  case BITWISE_XOR: wide = left ^ right; break;
+  case BITWISE_OR: wide = left | right; break;
+  default: unexpected("Unknown binary operator!");
+  }
+
+  if (wide < INT_MIN || wide > INT_MAX) return false;
+  target->asInt = (int)wide;
+  return true;
+}
+
+/* Fold the given binary operator on the given uxses. */
+static bool
+foldUxsBinary(size_t folded, size_t left, size_t right, Value* target) {
+  foldComparison(folded, left, right, target);
+
+  // Unsigned arithmetic wraps around; thus, only division by zero and shifting
+  // by too many bits are not defined.
+  switch (folded) {
+  case MULTIPLICATION: target->asUxs = left * right; return true;
+  case DIVISION:
+    if (!right) return false;
+    target->asUxs = left / right;
+    return true;
+  case REMINDER:
+    if (!right) return false;
+    target->asUxs = left % right;
+    return true;
+  case ADDITION: target->asUxs = left + right; return true;
+  case SUBTRACTION: target->asUxs = left - right; return true;
+  case LEFT_SHIFT:
+    if (right >= UXS_WIDTH_BITS) return false;
+    target->asUxs = left << right;
+    return true;
+  case RIGHT_SHIFT:
+    if (right >= UXS_WIDTH_BITS) return false;
+    target->asUxs = left >> right;
+    return true;
+  case BITWISE_AND: target->asUxs = left & right; return true;
+  case BITWISE_XOR: target->asUxs = left ^ right; return true;
+  case BITWISE_OR: target->asUxs = left | right; return true;
+  default: unexpected("Unknown binary operator!");
+  }
+}
+
+bool foldShiftOperation(
+  size_t folded, Type operation, Value shifted, Type amountType, Value amount,
+  Value* target) {
+  // Amount is not converted to the type of the operation, as C does not;
+  // thus, it is checked as it is. Shifting by a negative amount is not defined.
+  size_t bits = 0;
+  switch (amountType.tag) {
+  case TYPE_INT:
+    if (amount.asInt < 0) return false;
+    bits = (size_t)amount.asInt;
+    break;
+  case TYPE_UXS: bits = amount.asUxs; break;
+  case TYPE_BOOL:
+  case TYPE_BYTE: unexpected("Amount is promoted before a shift!");
+  case TYPE_FLOAT:
+  case TYPE_DOUBLE: unexpected("Not an integer type!");
+  case TYPE_META:
+  case TYPE_VOID: unexpected("Not an arithmetic type!");
+  default: unexpected("Unknown type variant!");
+  }
+
+  // Shifting by too many bits is not defined, which is checked before the
+  // amount is narrowed to an int.
+  switch (operation.tag) {
+  case TYPE_INT:
+    if (bits >= INT_WIDTH_BITS) return false;
+    return foldIntBinary(folded, shifted.asInt, (int)bits, target);
+  case TYPE_UXS: return foldUxsBinary(folded, shifted.asUxs, bits, target);
+  case TYPE_BOOL:
+  case TYPE_BYTE: unexpected("Operand is promoted before a shift!");
+  case TYPE_FLOAT:
+  case TYPE_DOUBLE: unexpected("Not an integer type!");
+  case TYPE_META:
+  case TYPE_VOID: unexpected("Not an arithmetic type!");
+  default: unexpected("Unknown type variant!");
+  }
+}
+
+/* Fold the given binary operator on the given doubles. Floats are folded as
+ * doubles, and converted back. */
+static bool
+foldRealBinary(size_t folded, double left, double right, double* target) {
+  switch (folded) {
+  case MULTIPLICATION: *target = left * right; break;
+  case DIVISION:
+    if (right == 0) return false;
+    *target = left / right;
+    break;
+  case ADDITION: *target = left + right; break;
+  case SUBTRACTION: *target = left - right; break;
+
+  // Reminder is not defined for reals in C.
+  case REMINDER: return false;
+  default: unexpected("Unknown binary operator!");
+  }
+
+  // Infinite results cannot be written as a literal.
+  return isfinite(*target);
+}
+
+bool foldBinaryOperation(
+  size_t folded, Type operation, Value left, Value right, Value* target) {
+  switch (operation.tag) {
+  case TYPE_BOOL:
+    switch (folded) {
+    case LOGICAL_AND: target->asBool = left.asBool && right.asBool; return true;
+    case LOGICAL_OR: target->asBool = left.asBool || right.asBool; return true;
+    default: unexpected("Only logical operators are done on bool!");
+    }
+  case TYPE_INT: return foldIntBinary(folded, left.asInt, right.asInt, target);
+  case TYPE_UXS: return foldUxsBinary(folded, left.asUxs, right.asUxs, target);
+  case TYPE_FLOAT: {
+    foldComparison(folded, left.asFloat, right.asFloat, target);
+    double result = 0;
+    if (!foldRealBinary(folded, left.asFloat, right.asFloat, &result))
+      return false;
+    // Result must be rounded to a float, and still be finite.
+    target->asFloat = (float)result;
+    return isfinite(target->asFloat);
+  }
+  case TYPE_DOUBLE:
+    foldComparison(folded, left.asDouble, right.asDouble, target);
+    return foldRealBinary(
+      folded, left.asDouble, right.asDouble, &target->asDouble);
+  case TYPE_BYTE: unexpected("Byte is promoted before an operation!");
+  case TYPE_META:
+  case TYPE_VOID: unexpected("Not an arithmetic type!");
+  default: unexpected("Unknown type variant!");
+  }
+}
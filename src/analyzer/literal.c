@@ -0,0 +1,63 @@
+// FileCopyrightText: 2022 Cem Geçgel <gecgelcem@outlook.com>
+// License-Identifier: GPL-3.0-or-later
+
+#include "analyzer/api.h"
+#include "analyzer/mod.h"
+#include "utility/api.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+
+LiteralCache createLiteralCache() {
+  return (LiteralCache){
+    .indices  = createMap(0),
+    .literals = {.first = NULL, .after = NULL, .bound = NULL},
+    .lookups  = 0,
+    .hits     = 0
+  };
+}
+
+void disposeLiteralCache(LiteralCache* disposed) {
+  for (CachedLiteral* literal = disposed->literals.first;
+       literal < disposed->literals.after; literal++)
+    disposeNumber(&literal->number);
+  disposed->literals.first =
+    allocateArray(disposed->literals.first, 0, CachedLiteral);
+  disposed->literals.after = disposed->literals.first;
+  disposed->literals.bound = disposed->literals.first;
+  disposeMap(&disposed->indices);
+}
+
+CachedLiteral* accessLiteral(LiteralCache* cache, String accessed) {
+  size_t const* index = accessValue(cache->indices, accessed);
+  if (index) return cache->literals.first + *index;
+
+  // Consume the sign, which is not in the parsed number.
+  bool   negative = *accessed.first == '-';
+  String parsed   = createString(
+      (negative || *accessed.first == '+') + accessed.first, accessed.after);
+
+  // Literal is not converted to any type yet.
+  insertEntry(
+    &cache->indices, accessed, cache->literals.after - cache->literals.first);
+  reserveArray(&cache->literals, 1, CachedLiteral);
+  *cache->literals.after =
+    (CachedLiteral){.number = parseDecimal(parsed), .negative = negative};
+  return cache->literals.after++;
+}
+
+NumberConversionResult convertLiteral(
+  LiteralCache* cache, Value* target, CachedLiteral* converted,
+  Type destination) {
+  LiteralConversion* conversion = converted->conversions + destination.tag;
+  cache->lookups++;
+  if (conversion->converted) {
+    cache->hits++;
+  } else {
+    conversion->result = convertNumberToArithmetic(
+      destination, &conversion->value, converted->number, converted->negative);
+    conversion->converted = true;
+  }
+  *target = conversion->value;
+  return conversion->result;
+}
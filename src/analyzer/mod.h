@@ -65,12 +65,33 @@ Value       convertSignedArithmetic(Type destination, int64_t converted);
  * type. */
 Value       convertUnsignedArithmetic(Type destination, uint64_t converted);
 
-/* Empty evaluation with the given initial capacity. */
-Evaluation createEvaluation(size_t initialCapacity);
-/* Release the resources used by the given evaluation. */
-void       disposeEvaluation(Evaluation* disposed);
-/* Add the given node to the end of the given evaluation. */
-void       pushEvaluationNode(Evaluation* target, EvaluationNode pushed);
+/* Fold the given prenary operator on the given operand, which has the type of
+ * the given operation, into the given target. Returns whether the result is
+ * defined, and can be written as a literal. */
+bool foldUnaryOperation(
+  size_t folded, Type operation, Value operand, Value* target);
+/* Fold the given binary operator, which is not an assignment, on the given
+ * operands, which have the type of the given operation, into the given target.
+ * Comparisons result in a bool. Returns whether the result is defined, and can
+ * be written as a literal. */
+bool foldBinaryOperation(
+  size_t folded, Type operation, Value left, Value right, Value* target);
+/* Fold the given shift operator on the given operand, which has the type of
+ * the given operation, by the given amount, which has the given promoted type,
+ * into the given target. Returns whether the result is defined. */
+bool foldShiftOperation(
+  size_t folded, Type operation, Value shifted, Type amountType, Value amount,
+  Value* target);
+
+/* Empty evaluation with the given initial capacity, which is allocated from
+ * the given arena. */
+Evaluation createEvaluation(Arena* arena, size_t initialCapacity);
+/* Release the resources used by the given evaluation to the given arena. */
+void       disposeEvaluation(Arena* arena, Evaluation* disposed);
+/* Add the given node to the end of the given evaluation, which grows in the
+ * given arena. */
+void       pushEvaluationNode(
+        Arena* arena, Evaluation* target, EvaluationNode pushed);
 
 /* Add the given symbol to the end of the given table. */
 void pushSymbol(Table* target, Symbol pushed);
@@ -88,13 +109,30 @@ typedef enum {
    * zero. */
   NUMBER_ZERO,
   /* Number has too many digits. */
-  NUMBER_TOO_PRECISE
+  NUMBER_TOO_PRECISE,
+  /* Number has few enough digits to fit its significand in 64 bits. Then, the
+   * significand is not allocated and the base of the exponent is 10. */
+  NUMBER_SMALL
 } NumberFlag;
 
+/* Digits of an infinite precision integer in base 2^64, which start from the
+ * least significant one. */
+typedef struct {
+  /* Pointer to the first limb if it exists. */
+  uint64_t* first;
+  /* Pointer to one after the last limb. */
+  uint64_t* after;
+  /* Pointer to one after the last allocated limb. */
+  uint64_t* bound;
+} Limbs;
+
 /* Dynamicly allocated, infinite precision, signed real. */
 typedef struct {
   /* Significand that is an infinite precision integer. */
-  Buffer     significand;
+  Limbs      significand;
+  /* Significand of a small number, which is used instead of the infinite
+   * precision one. */
+  uint64_t   smallSignificand;
   /* Signed exponent where the base is 2. Meaning the real value of the number
    * is `significand * 2^exponent`. */
   int        exponent;
@@ -116,6 +154,8 @@ typedef enum {
   NUMBER_CONVERSION_OUT_OUF_BOUNDS
 } NumberConversionResult;
 
+/* Compute the tables that are used for converting numbers. */
+void                   initNumbers(void);
 /* Parse the given decimal string into a number. */
 Number                 parseDecimal(String parsedDecimal);
 /* Release the memory used by the given number. */
@@ -125,6 +165,68 @@ void                   disposeNumber(Number* disposed);
 NumberConversionResult convertNumberToArithmetic(
   Type destination, Value* target, Number converted, bool negativeSign);
 
+/* Conversion of a literal to a type. */
+typedef struct {
+  /* Whether the literal was converted to the type. */
+  bool                   converted;
+  /* Result of the conversion. */
+  NumberConversionResult result;
+  /* Converted value if the conversion was successful. */
+  Value                  value;
+} LiteralConversion;
+
+/* Decimal literal that is parsed, and its conversions. */
+typedef struct {
+  /* Number that is parsed from the literal without its sign. */
+  Number            number;
+  /* Whether the literal has a negative sign. */
+  bool              negative;
+  /* Conversions to the types, which are indexed by the variants of the
+   * types. */
+  LiteralConversion conversions[TYPE_DOUBLE + 1];
+} CachedLiteral;
+
+/* Dynamic array of cached literals. */
+typedef struct {
+  /* Pointer to the first cached literal if it exists. */
+  CachedLiteral* first;
+  /* Pointer to one after the last cached literal. */
+  CachedLiteral* after;
+  /* Pointer to one after the last allocated cached literal. */
+  CachedLiteral* bound;
+} CachedLiterals;
+
+/* Decimal literals of a source file by their texts. The same literals are
+ * written many times; thus, a literal is parsed once, and it is converted
+ * once to every type. */
+typedef struct {
+  /* Indices of the cached literals by their texts, which include the
+   * signs. */
+  Map            indices;
+  /* Cached literals. */
+  CachedLiterals literals;
+  /* Amount of conversions that were asked from the cache. */
+  size_t         lookups;
+  /* Amount of conversions that were already in the cache. */
+  size_t         hits;
+} LiteralCache;
+
+/* Empty literal cache. */
+LiteralCache           createLiteralCache(void);
+/* Release the memory used by the given literal cache. */
+void                   disposeLiteralCache(LiteralCache* disposed);
+/* Cached literal of the given decimal literal text, which might have a sign.
+ * The literal is parsed if it is not in the given cache. Returned pointer is
+ * valid until another literal is accessed. */
+CachedLiteral*         accessLiteral(LiteralCache* cache, String accessed);
+/* Convert the given cached literal of the given cache into the given
+ * arithmetic value of the given destination type. Conversion is only done the
+ * first time it is asked for a type. Returns the conversion result. */
+NumberConversionResult convertLiteral(
+  LiteralCache* cache, Value* target, CachedLiteral* converted,
+  Type destination);
+
 /* Analyze the given parse into the given table by reporting to the given
- * source. */
-void analyzeParse(Table* target, Source* reported, Parse analyzed);
+ * source. Reports the statistics of the analysis if it is verbose. */
+void analyzeParse(
+  Table* target, Source* reported, Parse analyzed, bool verbose);
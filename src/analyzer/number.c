@@ -9,300 +9,456 @@
 #include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
-#include <stdlib.h>
-
-/* Amount of bits in a digit of the significand portion of the number. */
-#define SIGNIFICAND_DIGIT_BITS CHAR_BIT
-/* Base of the significand portion of the number. */
-#define SIGNIFICAND_BASE       (1 << SIGNIFICAND_DIGIT_BITS)
-
-/* Write the portion of the given value to the given digit. Returns the
- * remaining value after converted to equivalent value for the digit at the next
- * place. */
-static char extractDigit(int* extractedReminder) {
-  // Extract the portion of the value that belongs to the current digit.
-  int digit = *extractedReminder % SIGNIFICAND_BASE;
+#include <string.h>
+
+// Products and quotients of limbs are twice as wide as a limb. They are found
+// with the intrinsics in MSVC, and with the 128-bit integers in GCC and Clang.
+#if defined(_MSC_VER) && !defined(__clang__)
+  #define LIMB_INTRINSICS
+  #include <intrin.h>
+#else
+/* Unsigned integer that is twice as wide as a limb. */
+__extension__ typedef unsigned __int128 WideLimb;
+#endif
+
+/* Amount of bits in a limb of the significand. */
+#define LIMB_BITS (sizeof(uint64_t) * CHAR_BIT)
+
+/* Product of the given limbs. Writes the most significant half of the product
+ * to the given target, and returns the least significant half. */
+static uint64_t
+multiplyLimb(uint64_t multiplied, uint64_t multiplier, uint64_t* high) {
+#if defined(LIMB_INTRINSICS)
+  return _umul128(multiplied, multiplier, high);
+#else
+  WideLimb product = (WideLimb)multiplied * multiplier;
+  *high            = (uint64_t)(product >> LIMB_BITS);
+  return (uint64_t)product;
+#endif
+}
 
-  // Convert the reminder to an equivalent value for the place of the next
-  // digit.
-  *extractedReminder = (*extractedReminder - digit) / SIGNIFICAND_BASE;
+/* Quotient of the given two limbs divided by the given divisor, which must be
+ * bigger than the most significant limb. Writes the remainder to the given
+ * target. */
+static uint64_t
+divideLimb(uint64_t high, uint64_t low, uint64_t divisor, uint64_t* remainder) {
+#if defined(LIMB_INTRINSICS)
+  return _udiv128(high, low, divisor, remainder);
+#else
+  WideLimb dividend = (WideLimb)high << LIMB_BITS | low;
+  *remainder        = (uint64_t)(dividend % divisor);
+  return (uint64_t)(dividend / divisor);
+#endif
+}
 
-  return digit;
+/* Amount of zeros above the most significant set bit of the given limb, which
+ * is not zero. */
+static size_t countLeadingZeros(uint64_t counted) {
+#if defined(LIMB_INTRINSICS)
+  unsigned long index;
+  _BitScanReverse64(&index, counted);
+  return LIMB_BITS - 1 - index;
+#else
+  return __builtin_clzll(counted);
+#endif
 }
 
-/* Append the given value to the end of the given significand. */
-static void
-appendToSignificand(Buffer* targetSignificand, int* appendedReminder) {
-  // While there is remaining value, add it as a new digit.
-  while (*appendedReminder)
-    appendCharacter(targetSignificand, extractDigit(appendedReminder));
+/* Limbs with the given capacity. */
+static Limbs createLimbs(size_t initialCapacity) {
+  Limbs created = {.first = NULL, .after = NULL, .bound = NULL};
+  reserveArray(&created, initialCapacity, uint64_t);
+  return created;
 }
 
-/* Add the given value to the given significand. */
-static void addToSignificand(Buffer* targetSignificand, int added) {
-  // Start with the value to be added.
-  int reminder = added;
+/* Limbs with the same value as the given limbs. */
+static Limbs copyLimbs(Limbs copied) {
+  size_t limbs = copied.after - copied.first;
+  Limbs  copy  = createLimbs(limbs);
+  if (limbs) memcpy(copy.first, copied.first, limbs * sizeof(uint64_t));
+  copy.after += limbs;
+  return copy;
+}
 
-  for (char* digit = targetSignificand->first; digit < targetSignificand->after;
-       digit++) {
-    // Add the value of the digit.
-    reminder += (uint8_t)*digit;
-    *digit = extractDigit(&reminder);
+/* Release the memory used by the given limbs. */
+static void disposeLimbs(Limbs* disposed) {
+  disposed->first = allocateArray(disposed->first, 0, uint64_t);
+  disposed->after = disposed->first;
+  disposed->bound = disposed->first;
+}
 
-    // Early return if the reminder is empty.
-    if (!reminder) return;
-  }
-  appendToSignificand(targetSignificand, &reminder);
+/* Amount of limbs in the given limbs. */
+static size_t countLimbs(Limbs counted) {
+  return counted.after - counted.first;
 }
 
-/* Multiply the given significand with the given value. */
-static void multiplySignificand(Buffer* multiplied, int multiplier) {
-  int reminder = 0;
-  for (char* digit = multiplied->first; digit < multiplied->after; digit++) {
-    // Add the value of the digit after the multiplication.
-    reminder += (uint8_t)*digit * multiplier;
-    *digit = extractDigit(&reminder);
+/* Limb of the given limbs at the given index, which is zero after the most
+ * significant limb. */
+static uint64_t getLimb(Limbs source, size_t gotten) {
+  return gotten < countLimbs(source) ? source.first[gotten] : 0;
+}
 
-    // Cannot early return here like addition, because the remaining digits are
-    // yet to be multiplied. In addition, the value is added once; however, the
-    // multiplication should be done for every digit. Hence, cannot short
-    // circuit out.
-  }
-  appendToSignificand(multiplied, &reminder);
+/* Add the given limb to the end of the given limbs. */
+static void pushLimb(Limbs* target, uint64_t pushed) {
+  reserveArray(target, 1, uint64_t);
+  *target->after++ = pushed;
 }
 
-/* Remove the leading zeros from the given significand. */
-static void trimLeadingZeros(Buffer* trimmed) {
-  // Make sure to leave at least a single zero digit in the significand.
-  while (trimmed->after > trimmed->first + 1 && !trimmed->after[-1])
+/* Remove the most significant limbs that are zero. */
+static void trimLimbs(Limbs* trimmed) {
+  while (trimmed->after > trimmed->first && !trimmed->after[-1])
     trimmed->after--;
 }
 
-/* Divide the given significand with the given value. */
-static void divideSignificand(Buffer* divided, int divider) {
-  int reminder = 0;
+/* Amount of bits in the given limbs upto and including the most significant
+ * set bit. */
+static size_t measureLimbs(Limbs measured) {
+  if (!countLimbs(measured)) return 0;
+  return countLimbs(measured) * LIMB_BITS -
+         countLeadingZeros(measured.after[-1]);
+}
 
-  for (char* digit = divided->after - 1; digit >= divided->first; digit--) {
-    // Convert the reminder to an equivalent value for the place of the previous
-    // digit.
-    reminder *= SIGNIFICAND_BASE;
+/* Bit of the given limbs at the given index. */
+static bool getLimbBit(Limbs source, size_t gotten) {
+  return getLimb(source, gotten / LIMB_BITS) >> gotten % LIMB_BITS & 1;
+}
 
-    // Add the value of the digit.
-    reminder += (uint8_t)*digit;
+/* Bits of the given limbs that start at the given index, and are as many as
+ * the given width, which is at most the width of a limb. */
+static uint64_t extractLimbBits(Limbs source, size_t start, size_t width) {
+  size_t   limb   = start / LIMB_BITS;
+  size_t   offset = start % LIMB_BITS;
+  uint64_t bits   = getLimb(source, limb) >> offset;
+  if (offset) bits |= getLimb(source, limb + 1) << (LIMB_BITS - offset);
+  if (width == LIMB_BITS) return bits;
+  return bits & (((uint64_t)1 << width) - 1);
+}
 
-    // Set the current digit to whole part of the division.
-    *digit = reminder / divider;
+/* Whether any of the bits of the given limbs that are below the given index is
+ * set. */
+static bool checkLimbsBelow(Limbs checked, size_t index) {
+  size_t limb = index / LIMB_BITS;
+  for (size_t below = 0; below < limb && below < countLimbs(checked); below++)
+    if (checked.first[below]) return true;
+  return getLimb(checked, limb) & (((uint64_t)1 << index % LIMB_BITS) - 1);
+}
 
-    // Leave the reminder from the division for the previous digit.
-    reminder %= divider;
+/* Multiply the given limbs with the given multiplier, and add the given
+ * value. */
+static void
+multiplyAndAddLimbs(Limbs* target, uint64_t multiplier, uint64_t added) {
+  uint64_t carry = added;
+  for (uint64_t* limb = target->first; limb < target->after; limb++) {
+    uint64_t high;
+    uint64_t low = multiplyLimb(*limb, multiplier, &high);
+    low += carry;
+    carry = high + (low < carry);
+    *limb = low;
   }
-
-  // Remove any leading zeros created by the division.
-  trimLeadingZeros(divided);
+  if (carry) pushLimb(target, carry);
 }
 
-/* Modulus of the given significand with the given value. */
-static int findSignificandModulus(Buffer modded, int mod) {
-  int reminder = 0;
-
-  for (char const* digit = modded.after - 1; digit >= modded.first; digit--) {
-    // Convert the reminder to an equivalent value for the place of the previous
-    // digit.
-    reminder *= SIGNIFICAND_BASE;
-
-    // Add the value of the digit.
-    reminder += (uint8_t)*digit;
-
-    // Leave the reminder from the division for the previous digit.
-    reminder %= mod;
+/* Product of the given limbs. */
+static Limbs multiplyLimbs(Limbs multiplied, Limbs multiplier) {
+  size_t multipliedCount = countLimbs(multiplied);
+  size_t multiplierCount = countLimbs(multiplier);
+  Limbs  product         = createLimbs(multipliedCount + multiplierCount);
+  product.after += multipliedCount + multiplierCount;
+  if (countLimbs(product))
+    memset(product.first, 0, countLimbs(product) * sizeof(uint64_t));
+
+  // Add the product of every limb of the multiplied with the multiplier.
+  for (size_t multipliedIndex = 0; multipliedIndex < multipliedCount;
+       multipliedIndex++) {
+    uint64_t  carry = 0;
+    uint64_t* place = product.first + multipliedIndex;
+    for (size_t multiplierIndex = 0; multiplierIndex < multiplierCount;
+         multiplierIndex++, place++) {
+      // Product of two limbs plus two other limbs still fits in two limbs.
+      uint64_t high;
+      uint64_t low = multiplyLimb(
+        multiplied.first[multipliedIndex], multiplier.first[multiplierIndex],
+        &high);
+      low += carry;
+      high += low < carry;
+      low += *place;
+      high += low < *place;
+      *place = low;
+      carry  = high;
+    }
+    *place = carry;
   }
 
-  return reminder;
+  trimLimbs(&product);
+  return product;
 }
 
-/* Remove the leading and trailing zeros from the given number by adding them to
- * the exponent, which has the given base. */
-static void trimNumber(Number* trimmed, int exponentBase) {
-  // Divide with the base and increment exponent until there is no whole integer
-  // division possible.
-  while (!findSignificandModulus(trimmed->significand, exponentBase)) {
-    divideSignificand(&trimmed->significand, exponentBase);
-    trimmed->exponent++;
+/* Multiply the given limbs with 2 to the power of the given shift. */
+static void shiftLimbs(Limbs* shifted, size_t shift) {
+  size_t limbShift = shift / LIMB_BITS;
+  size_t bitShift  = shift % LIMB_BITS;
+  reserveArray(shifted, limbShift + 1, uint64_t);
+  Limbs source = *shifted;
+  shifted->after += limbShift + 1;
+
+  // Start from the most significant limb, so that every limb is read before it
+  // is overwritten.
+  for (size_t index = countLimbs(*shifted); index > 0; index--) {
+    size_t   place = index - 1;
+    uint64_t moved = 0;
+    if (place >= limbShift)
+      moved = getLimb(source, place - limbShift) << bitShift;
+    if (bitShift && place > limbShift)
+      moved |= getLimb(source, place - limbShift - 1) >> (LIMB_BITS - bitShift);
+    shifted->first[place] = moved;
   }
-  trimLeadingZeros(&trimmed->significand);
-}
 
-/* Bit of the given value at the given index. */
-static int getBitAt(uint64_t source, size_t gottenBit) {
-  return source >> gottenBit & 1;
+  trimLimbs(shifted);
 }
 
-/* Given value that has the bit in the given index modified to the given value.
- */
-static uint64_t setBitAt(uint64_t target, size_t setBit, int setValue) {
-  return target | ((uint64_t)setValue << setBit);
-}
+/* Divide the given dividend with the given divisor, which has more than one
+ * limb, into the given quotient, which has enough space. The dividend has one
+ * more limb than the divisor needs, and it is left with the remainder. */
+static void divideLongLimbs(Limbs dividend, Limbs divisor, uint64_t* quotient) {
+  size_t   divisorCount = countLimbs(divisor);
+  uint64_t top          = divisor.after[-1];
+  uint64_t second       = divisor.after[-2];
+
+  for (size_t index = countLimbs(dividend) - divisorCount; index > 0; index--) {
+    // Current part of the dividend that is divided.
+    uint64_t* part = dividend.first + index - 1;
+
+    // Estimate the quotient limb with the most significant limbs. As the
+    // divisor is normalized, the estimate is at most two too big, and the
+    // second limb of the divisor corrects it most of the time. When the most
+    // significant limbs are equal, the estimate is the biggest limb, whose
+    // remainder might not fit in a limb.
+    uint64_t estimate;
+    uint64_t estimateRemainder;
+    bool     remainderOverflow = false;
+    if (part[divisorCount] < top) {
+      estimate = divideLimb(
+        part[divisorCount], part[divisorCount - 1], top, &estimateRemainder);
+    } else {
+      estimate          = UINT64_MAX;
+      estimateRemainder = part[divisorCount - 1] + top;
+      remainderOverflow = estimateRemainder < top;
+    }
+    while (!remainderOverflow) {
+      uint64_t high;
+      uint64_t low = multiplyLimb(estimate, second, &high);
+      if (
+        high < estimateRemainder ||
+        (high == estimateRemainder && low <= part[divisorCount - 2]))
+        break;
+      estimate--;
+      estimateRemainder += top;
+      remainderOverflow = estimateRemainder < top;
+    }
 
-/* Bit of the given significand at the given index. */
-static int getBitOfSignificandAt(Buffer source, size_t gottenBit) {
-  // Find the digit the bit is in and get the bit in the digit.
-  return getBitAt(
-    (uint8_t)source.first[gottenBit / SIGNIFICAND_DIGIT_BITS],
-    gottenBit % SIGNIFICAND_DIGIT_BITS);
-}
+    // Subtract the estimate times the divisor from the part.
+    uint64_t carry  = 0;
+    bool     borrow = false;
+    for (size_t limb = 0; limb < divisorCount; limb++) {
+      uint64_t high;
+      uint64_t low = multiplyLimb(estimate, divisor.first[limb], &high);
+      low += carry;
+      carry           = high + (low < carry);
+      bool nextBorrow = part[limb] < low || (part[limb] == low && borrow);
+      part[limb] -= low + borrow;
+      borrow = nextBorrow;
+    }
+    bool negative =
+      part[divisorCount] < carry || (part[divisorCount] == carry && borrow);
+    part[divisorCount] -= carry + borrow;
+
+    // If the part became negative, the estimate was one too big; thus, add
+    // the divisor back.
+    if (negative) {
+      estimate--;
+      bool added = false;
+      for (size_t limb = 0; limb < divisorCount; limb++) {
+        uint64_t sum      = part[limb] + divisor.first[limb];
+        bool     overflow = sum < part[limb];
+        part[limb]        = sum + added;
+        added             = overflow || part[limb] < sum;
+      }
+      part[divisorCount] += added;
+    }
 
-/* Index of the most significant bit of the given significand. */
-static size_t findMostSignificantBit(Buffer found) {
-  // Start from the highest possible index and return the first index that has a
-  // set bit.
-  for (size_t highestIndex = countBytes(found) * SIGNIFICAND_DIGIT_BITS - 1;
-       highestIndex > 0; highestIndex--)
-    if (getBitOfSignificandAt(found, highestIndex)) return highestIndex;
-  return 0;
+    quotient[index - 1] = estimate;
+  }
 }
 
-/* Maximum amount of bits to round the significand at when rebasing. */
-#define REBASE_SIGNIFICAND_MAX_BITS 64
+/* Divide the given dividend with the given divisor, which is not zero, into the
+ * given quotient. Returns whether the division has a remainder. */
+static bool divideLimbs(Limbs dividend, Limbs divisor, Limbs* quotient) {
+  size_t dividendCount = countLimbs(dividend);
+  size_t divisorCount  = countLimbs(divisor);
+  *quotient            = createLimbs(0);
+  if (dividendCount < divisorCount) return dividendCount > 0;
+  reserveArray(quotient, dividendCount - divisorCount + 1, uint64_t);
+  quotient->after += dividendCount - divisorCount + 1;
+
+  // Divide by a single limb without estimating.
+  if (divisorCount == 1) {
+    uint64_t remainder = 0;
+    for (size_t index = dividendCount; index > 0; index--)
+      quotient->first[index - 1] = divideLimb(
+        remainder, dividend.first[index - 1], *divisor.first, &remainder);
+    trimLimbs(quotient);
+    return remainder != 0;
+  }
 
-/* Change the base of the given number from the given base to 2. */
-static void rebaseNumber(Number* rebased, int currentBase) {
-  // If the exponent is positive, just multiply them away.
-  if (rebased->exponent >= 0) {
-    while (rebased->exponent) {
-      multiplySignificand(&rebased->significand, currentBase);
-      rebased->exponent--;
-    }
+  // Shift both of them so that the most significant bit of the divisor is set,
+  // which is necessary for estimating the quotient limbs.
+  size_t normalization = countLeadingZeros(divisor.after[-1]);
+  Limbs  remainder     = copyLimbs(dividend);
+  Limbs  normalized    = copyLimbs(divisor);
+  shiftLimbs(&remainder, normalization);
+  shiftLimbs(&normalized, normalization);
+  while (countLimbs(remainder) <= dividendCount) pushLimb(&remainder, 0);
+
+  divideLongLimbs(remainder, normalized, quotient->first);
+  trimLimbs(quotient);
+
+  // Remainder is left in the least significant limbs.
+  remainder.after = remainder.first + divisorCount;
+  trimLimbs(&remainder);
+  bool hasRemainder = countLimbs(remainder);
+  disposeLimbs(&remainder);
+  disposeLimbs(&normalized);
+  return hasRemainder;
+}
 
-    // Trim to the new base and return.
-    trimNumber(rebased, 2);
-    return;
+/* Power of 5 with the given exponent. It is found by squaring the powers of
+ * the bits of the exponent, which needs a multiplication for every bit of the
+ * exponent instead of one for every 5. */
+static Limbs raiseFive(size_t exponent) {
+  Limbs power = createLimbs(1);
+  pushLimb(&power, 1);
+
+  // Go through the bits of the exponent from the most significant one.
+  size_t bit = 1;
+  while (bit <= exponent / 2) bit *= 2;
+  for (; bit; bit /= 2) {
+    Limbs squared = multiplyLimbs(power, power);
+    disposeLimbs(&power);
+    power = squared;
+    if (exponent & bit) multiplyAndAddLimbs(&power, 5, 0);
   }
+  return power;
+}
 
-  // Check whether the exponent can be made positive by dividing the
-  // significand.
-  while (!findSignificandModulus(rebased->significand, currentBase)) {
-    divideSignificand(&rebased->significand, currentBase);
-    rebased->exponent++;
-
-    // If the exponent could be raised to zero, trim and return.
-    if (rebased->exponent) {
-      // Trim to the new base and return.
-      trimNumber(rebased, 2);
-      return;
-    }
-  }
+/* Least amount of bits in the quotient when the number is divided while
+ * rebasing, which is more than any mantissa needs for rounding. */
+#define REBASE_QUOTIENT_BITS 64
 
-  // Exponent is negative, rounding might be necessary depending on the prime
-  // numbers that make up the bases. Try to limit the significand to 64 bits.
-  size_t leadingBitIndex = findMostSignificantBit(rebased->significand);
-  int    scaledUp        = 0;
-
-  // Scale up the number with the new base until exponent is zerod or the
-  // scaling up becomes too much.
-  while (rebased->exponent) {
-    // As the new base is 2, the scaling up just increses the index of the
-    // leading bit, which is the limited quantitiy.
-    if (scaledUp + leadingBitIndex >= REBASE_SIGNIFICAND_MAX_BITS) break;
-    multiplySignificand(&rebased->significand, 2);
-    trimNumber(rebased, currentBase);
-    scaledUp++;
+/* Change the base of the exponent of the given number from 10 to 2. */
+static void rebaseNumber(Number* rebased) {
+  if (!countLimbs(rebased->significand)) {
+    rebased->flag = NUMBER_ZERO;
+    return;
   }
 
-  // If scaling up did not work, which means the current base has a prime in it
-  // that is not present in the new base, round up. Other rounding modes are too
-  // fancy to implement here and they do not change the results. The double,
-  // which has the biggest precision is only 53 bits long. (64-bit unsigned
-  // integer, which has more precision than double, should have a positive
-  // exponent anyways, otherwise it would not be an integer.)
-  while (rebased->exponent) {
-    int reminder = findSignificandModulus(rebased->significand, currentBase);
-    addToSignificand(&rebased->significand, currentBase - reminder);
-    trimNumber(rebased, currentBase);
+  // As 10 is 2 times 5, the exponent stays the same with the base 2, and the
+  // significand is multiplied or divided with the power of 5.
+  if (!rebased->exponent) return;
+  if (rebased->exponent > 0) {
+    Limbs power   = raiseFive(rebased->exponent);
+    Limbs product = multiplyLimbs(rebased->significand, power);
+    disposeLimbs(&power);
+    disposeLimbs(&rebased->significand);
+    rebased->significand = product;
+    return;
+  }
+  Limbs power = raiseFive(-rebased->exponent);
+
+  // Scale up the significand so that the quotient has enough bits.
+  size_t significandBits = measureLimbs(rebased->significand);
+  size_t powerBits       = measureLimbs(power);
+  if (significandBits < powerBits + REBASE_QUOTIENT_BITS) {
+    size_t scale = powerBits + REBASE_QUOTIENT_BITS - significandBits;
+    shiftLimbs(&rebased->significand, scale);
+    rebased->exponent -= (int)scale;
   }
 
-  // Trim and remove the scale up.
-  trimNumber(rebased, 2);
-  rebased->exponent -= scaledUp;
+  // A remainder is kept as the least significant bit, which is below the bits
+  // that are used for rounding. Then, the rounding sees that the number is a
+  // bit more than the quotient, which is the case.
+  Limbs quotient;
+  if (divideLimbs(rebased->significand, power, &quotient)) *quotient.first |= 1;
+  disposeLimbs(&power);
+  disposeLimbs(&rebased->significand);
+  rebased->significand = quotient;
 }
 
-/* Base of the parsed exponent integer. */
-#define EXPONENT_BASE  10
-/* Limiting amount of the exponent where it is considered too big. */
-#define EXPONENT_LIMIT (1 << 16)
-
-/* Parse the exponent of a number. */
-Number parseExponent(String parsedExponent) {
-  // Consume the sign character.
-  bool negative = *parsedExponent.first == '-';
-  if (negative || *parsedExponent.first == '+') parsedExponent.after++;
-
-  int exponent = 0;
-
-  for (char const* digit = parsedExponent.first; digit < parsedExponent.after;
-       digit++) {
-    // Skip any undercores in the number.
-    if (*digit == '_') continue;
-
-    // Increase the decimal place of the already parse digits and parse the
-    // current one.
-    exponent *= EXPONENT_BASE;
-    exponent += *digit - '0';
-
-    // Check the exponent, if it at the limit return zero or infinite depending
-    // on the sign of the exponent.
-    if (exponent >= EXPONENT_LIMIT) {
-      return (Number){
-        .significand = createBuffer(0),
-        .exponent    = 0,
-        .flag        = negative ? NUMBER_ZERO : NUMBER_INFINITE};
-    }
+/* Smallest exponent of 10 whose power of 5 is in the table. Smaller powers
+ * underflow any real that is multiplied by them. */
+#define POWER_TABLE_MINIMUM   (-342)
+/* Largest exponent of 10 whose power of 5 is in the table. Larger powers
+ * overflow any real that is multiplied by them. */
+#define POWER_TABLE_MAXIMUM   308
+/* Largest exponent of 5 whose power fits in a limb. */
+#define LIMB_FIVE_POWER_LIMIT 27
+/* Largest exponent of 5 whose power fits in two limbs. */
+#define WIDE_FIVE_POWER_LIMIT 55
+
+/* Most significant 128 bits of the powers of 5 from the smallest exponent in
+ * the table, as the most significant limb followed by the least significant
+ * one. Bits are shifted so that the most significant one is set. Negative
+ * powers are the reciprocals, which are rounded up. */
+static uint64_t powersOfFive[POWER_TABLE_MAXIMUM - POWER_TABLE_MINIMUM + 1][2];
+
+/* Write the most significant 128 bits of the given limbs, which are shifted so
+ * that the most significant one is set, to the given entry of the table. */
+static void writePowerOfFive(uint64_t* entry, Limbs written) {
+  size_t bits = measureLimbs(written);
+  if (bits >= 2 * LIMB_BITS) {
+    entry[0] = extractLimbBits(written, bits - LIMB_BITS, LIMB_BITS);
+    entry[1] = extractLimbBits(written, bits - 2 * LIMB_BITS, LIMB_BITS);
+    return;
   }
+  Limbs shifted = copyLimbs(written);
+  shiftLimbs(&shifted, 2 * LIMB_BITS - bits);
+  entry[0] = getLimb(shifted, 1);
+  entry[1] = getLimb(shifted, 0);
+  disposeLimbs(&shifted);
+}
 
-  // If negative, set the sign of the exponent.
-  if (negative) exponent = -exponent;
-  return (Number){
-    .significand = createBuffer(0),
-    .exponent    = exponent,
-    .flag        = NUMBER_NORMAL};
-}
-
-/* Comparison of the given number with the given value. Returns positive, zero,
- * or negative depending on whether the number is greater than, equals to, or
- * less than the given value, respectively. */
-int compareNumber(Number comparedNumber, uint64_t comparedValue) {
-  int mostSignificant = findMostSignificantBit(comparedNumber.significand) +
-                        comparedNumber.exponent;
-
-  // Find the most significand bit of the compared value. Make sure at least a
-  // bit is left.
-  int mostSignificantValueBit = sizeof(uint64_t) * CHAR_BIT - 1;
-  while (mostSignificantValueBit > 1 &&
-         !getBitAt(comparedValue, mostSignificantValueBit))
-    mostSignificantValueBit--;
-
-  // If the indicies of the most significant bits are not the same, the one with
-  // the more bits is bigger.
-  if (mostSignificant != mostSignificantValueBit)
-    return mostSignificant - mostSignificantValueBit;
-
-  // If they have equal number of bits, compared them one by one from the most
-  // significant to least. The bits of the number is all zeros after the
-  // exponent scale up is reached.
-  for (int bitIndex = mostSignificant; bitIndex >= comparedNumber.exponent;
-       bitIndex--) {
-    int valueBit  = getBitAt(comparedValue, bitIndex);
-    int numberBit = getBitOfSignificandAt(
-      comparedNumber.significand, bitIndex - comparedNumber.exponent);
-    if (numberBit != valueBit) return numberBit - valueBit;
+void initNumbers() {
+  // Positive powers are found by multiplying with 5 one by one.
+  Limbs power = createLimbs(1);
+  pushLimb(&power, 1);
+  for (int exponent = 0; exponent <= POWER_TABLE_MAXIMUM; exponent++) {
+    writePowerOfFive(powersOfFive[exponent - POWER_TABLE_MINIMUM], power);
+    multiplyAndAddLimbs(&power, 5, 0);
   }
-
-  // If the value has a set bit in the part that corresponds to the scaled up
-  // part of the number, the value is bigger.
-  for (int bitIndex = comparedNumber.exponent - 1; bitIndex >= 0; bitIndex--)
-    if (getBitAt(comparedValue, bitIndex)) return -1;
-
-  // If all are the same, they are equal.
-  return 0;
+  disposeLimbs(&power);
+
+  // Negative powers are found by dividing a power of 2 with the positive ones.
+  // The reciprocals of the powers that fit in a limb are found with exactly
+  // 128 bits, and the others are found with more bits and then truncated.
+  power = createLimbs(1);
+  pushLimb(&power, 1);
+  for (int exponent = -1; exponent >= POWER_TABLE_MINIMUM; exponent--) {
+    multiplyAndAddLimbs(&power, 5, 0);
+    size_t bits  = measureLimbs(power);
+    size_t scale = exponent >= -LIMB_FIVE_POWER_LIMIT
+                   ? bits + 2 * LIMB_BITS - 1
+                   : 2 * bits + 2 * LIMB_BITS;
+
+    // Quotient is rounded up by adding one to it.
+    Limbs dividend = createLimbs(1);
+    pushLimb(&dividend, 1);
+    shiftLimbs(&dividend, scale);
+    Limbs reciprocal;
+    divideLimbs(dividend, power, &reciprocal);
+    multiplyAndAddLimbs(&reciprocal, 1, 1);
+    writePowerOfFive(powersOfFive[exponent - POWER_TABLE_MINIMUM], reciprocal);
+    disposeLimbs(&reciprocal);
+    disposeLimbs(&dividend);
+  }
+  disposeLimbs(&power);
 }
 
 /* Whether the given number is an integer. */
@@ -310,231 +466,561 @@ bool checkNumberIntegerness(Number checked) {
   return checked.flag == NUMBER_NORMAL && checked.exponent >= 0;
 }
 
-/* Value of the given number as an 64-bit unsigned integer. */
+/* Whether the given integer number fits in 64 bits. */
+static bool checkNumberFitting(Number checked) {
+  return measureLimbs(checked.significand) + checked.exponent <= LIMB_BITS;
+}
+
+/* Value of the given integer number, which fits in 64 bits, as an 64-bit
+ * unsigned integer. */
 uint64_t convertNumberToInteger(Number converted) {
-  union {
-    uint64_t asInteger;
-    char     asBytes[sizeof(uint64_t)];
-  } converter = {.asInteger = 0};
+  if (!countLimbs(converted.significand)) return 0;
+  return *converted.significand.first << converted.exponent;
+}
 
-  // Copy the bytes to the integer; then, shift it by the exponent.
-  for (size_t index = 0; index < countBytes(converted.significand); index++)
-    converter.asBytes[index] = converted.significand.first[index];
-  return converter.asInteger << converted.exponent;
+/* Bits of the given number as a binary real with the given widths of the
+ * mantissa and the exponent. Number is rounded to the nearest, and to the even
+ * one on ties. */
+static uint64_t
+roundNumber(Number rounded, int mantissaWidth, int exponentWidth) {
+  int      exponentMask = (1 << exponentWidth) - 1;
+  uint64_t infinite     = (uint64_t)exponentMask << mantissaWidth;
+  if (rounded.flag == NUMBER_INFINITE) return infinite;
+  int measured = (int)measureLimbs(rounded.significand);
+  if (rounded.flag == NUMBER_ZERO || !measured) return 0;
+
+  // Find the place of the least significant bit that is kept. Mantissa has an
+  // implicit bit, which is not there for subnormals that have the smallest
+  // exponent instead.
+  int bias            = exponentMask / 2;
+  int lowest          = measured - 1 - mantissaWidth;
+  int subnormalLowest = 1 - bias - mantissaWidth - rounded.exponent;
+  if (lowest < subnormalLowest) lowest = subnormalLowest;
+
+  // Exponent that has the bias and the implicit bit, which is one less for
+  // subnormals.
+  int biased = lowest + rounded.exponent + mantissaWidth + bias - 1;
+  if (biased >= exponentMask) return infinite;
+
+  // Round using the first bit that is not kept and whether the bits after it
+  // are all zero.
+  uint64_t mantissa = 0;
+  if (lowest <= 0)
+    mantissa = extractLimbBits(rounded.significand, 0, measured) << -lowest;
+  else {
+    if (lowest < measured)
+      mantissa =
+        extractLimbBits(rounded.significand, lowest, measured - lowest);
+    if (
+      getLimbBit(rounded.significand, lowest - 1) &&
+      (checkLimbsBelow(rounded.significand, lowest - 1) || mantissa & 1))
+      mantissa++;
+  }
+
+  // Implicit bit of the mantissa is added to the exponent, which also carries
+  // a mantissa that is rounded up to the next power of two.
+  uint64_t bits = ((uint64_t)biased << mantissaWidth) + mantissa;
+  return bits < infinite ? bits : infinite;
 }
 
 /* Amount of bits that are reserved for the exponent in floats. */
 #define FLOAT_EXPONENT_WIDTH 8
-/* Bias on the exponent of floats. */
-#define FLOAT_EXPONENT_BIAS  ((1 << (FLOAT_EXPONENT_WIDTH - 1)) - 1)
-/* Mask that is as wide as the exponent of floats. */
-#define FLOAT_EXPONENT_MASK  ((1 << FLOAT_EXPONENT_WIDTH) - 1)
 /* Amount of bits that is reserved for the significand in floats. */
 #define FLOAT_MANTISSA_WIDTH \
   (sizeof(float) * CHAR_BIT - FLOAT_EXPONENT_WIDTH - 1)
 
-/* Value of the given number as a float. */
-float convertNumberToFloat(Number converted) {
-  // Handle special cases.
-  if (converted.flag == NUMBER_INFINITE) return (float)1 / 0;
-  if (converted.flag == NUMBER_ZERO) return 0;
-
+/* Float with the given bits. */
+static float reinterpretFloat(uint32_t bits) {
   union {
     float    asFloat;
     uint32_t asInteger;
-  } converter = {.asInteger = 0};
-
-  // Copy the bits upto the end of the mantissa or the most significant bit.
-  size_t mostSignificantBit = findMostSignificantBit(converted.significand);
-  size_t bitIndex           = 0;
-  for (; bitIndex < FLOAT_MANTISSA_WIDTH && bitIndex < mostSignificantBit;
-       bitIndex++)
-    converter.asInteger = setBitAt(
-      converter.asInteger, FLOAT_MANTISSA_WIDTH - 1 - bitIndex,
-      getBitOfSignificandAt(
-        converted.significand, mostSignificantBit - 1 - bitIndex));
-
-  // Round the value up if necessary.
-  int exponent = converted.exponent;
-  if (
-    bitIndex < mostSignificantBit &&
-    getBitOfSignificandAt(
-      converted.significand, mostSignificantBit - 1 - bitIndex)) {
-    converter.asInteger++;
-    // Scale the exponent if the mantissa became too big.
-    if (converter.asInteger >= (uint32_t)1 << FLOAT_MANTISSA_WIDTH) {
-      converter.asInteger >>= 1;
-      exponent++;
-    }
-  }
-
-  // Find the final exponent, check if it is too big or zero.
-  exponent += FLOAT_EXPONENT_BIAS + mostSignificantBit;
-  if (exponent > FLOAT_EXPONENT_MASK) return (float)1 / 0;
-  expect(exponent, "Number is subnormal!");
-  converter.asInteger |= (uint32_t)exponent << FLOAT_MANTISSA_WIDTH;
+  } converter = {.asInteger = bits};
 
   return converter.asFloat;
 }
 
+/* Value of the given number as a float. */
+float convertNumberToFloat(Number converted) {
+  return reinterpretFloat((uint32_t)roundNumber(
+    converted, FLOAT_MANTISSA_WIDTH, FLOAT_EXPONENT_WIDTH));
+}
+
 /* Amount of bits that are reserved for the exponent in doubles. */
 #define DOUBLE_EXPONENT_WIDTH 11
-/* Bias on the exponent of doubles. */
-#define DOUBLE_EXPONENT_BIAS  ((1 << (DOUBLE_EXPONENT_WIDTH - 1)) - 1)
-/* Mask that is as wide as the exponent of doubles. */
-#define DOUBLE_EXPONENT_MASK  ((1 << DOUBLE_EXPONENT_WIDTH) - 1)
 /* Amount of bits that is reserved for the significand in doubles. */
 #define DOUBLE_MANTISSA_WIDTH \
   (sizeof(double) * CHAR_BIT - DOUBLE_EXPONENT_WIDTH - 1)
 
-/* Value of the given number as a double. */
-double convertNumberToDouble(Number converted) {
-  // Handle special cases.
-  if (converted.flag == NUMBER_INFINITE) return (double)1 / 0;
-  if (converted.flag == NUMBER_ZERO) return 0;
-
+/* Double with the given bits. */
+static double reinterpretDouble(uint64_t bits) {
   union {
     double   asDouble;
     uint64_t asInteger;
-  } converter = {.asInteger = 0};
-
-  // Copy the bits upto the end of the mantissa or the most significant bit.
-  size_t mostSignificantBit = findMostSignificantBit(converted.significand);
-  size_t bitIndex           = 0;
-  for (; bitIndex < DOUBLE_MANTISSA_WIDTH && bitIndex < mostSignificantBit;
-       bitIndex++)
-    converter.asInteger = setBitAt(
-      converter.asInteger, DOUBLE_MANTISSA_WIDTH - 1 - bitIndex,
-      getBitOfSignificandAt(
-        converted.significand, mostSignificantBit - 1 - bitIndex));
-
-  // Round the value up if necessary.
-  int exponent = converted.exponent;
-  if (
-    bitIndex < mostSignificantBit &&
-    getBitOfSignificandAt(
-      converted.significand, mostSignificantBit - 1 - bitIndex)) {
-    converter.asInteger++;
-    // Scale the exponent if the mantissa became too big.
-    if (converter.asInteger >= (uint64_t)1 << DOUBLE_MANTISSA_WIDTH) {
-      converter.asInteger >>= 1;
-      exponent++;
-    }
-  }
-
-  // Find the final exponent, check if it is too big or zero.
-  exponent += DOUBLE_EXPONENT_BIAS + mostSignificantBit;
-  if (exponent > DOUBLE_EXPONENT_MASK) return (double)1 / 0;
-  expect(exponent, "Number is subnormal!");
-  converter.asInteger |= (uint64_t)exponent << DOUBLE_MANTISSA_WIDTH;
+  } converter = {.asInteger = bits};
 
   return converter.asDouble;
 }
 
+/* Value of the given number as a double. */
+double convertNumberToDouble(Number converted) {
+  return reinterpretDouble(
+    roundNumber(converted, DOUBLE_MANTISSA_WIDTH, DOUBLE_EXPONENT_WIDTH));
+}
+
 /* Maximum amount of digits to parse for a number. */
 #define PARSED_DIGIT_LIMIT (1 << 16)
 /* Base of the decimal number parser. */
 #define DECIMAL_BASE       10
+/* Base of the parsed exponent integer. */
+#define EXPONENT_BASE      10
+/* Limiting amount of the exponent where it is considered too big. */
+#define EXPONENT_LIMIT     (1 << 16)
+/* Most amount of decimal digits that always fit in a limb. */
+#define LIMB_DIGIT_LIMIT   19
+
+/* Powers of 10 that fit in a limb. */
+static uint64_t const LIMB_POWERS_OF_TEN[] = {
+  1,
+  10,
+  100,
+  1000,
+  10000,
+  100000,
+  1000000,
+  10000000,
+  100000000,
+  1000000000,
+  10000000000,
+  100000000000,
+  1000000000000,
+  10000000000000,
+  100000000000000,
+  1000000000000000,
+  10000000000000000,
+  100000000000000000,
+  1000000000000000000,
+  10000000000000000000u,
+};
+
+/* Significand of a decimal that is being parsed. Digits are collected in a
+ * limb, which is added to the infinite precision significand when it is full.
+ * Thus, there is a multiplication for every 19 digits, and most literals fit
+ * in the collected limb without allocating. */
+typedef struct {
+  /* Digits that were before the collected ones. */
+  Limbs    limbs;
+  /* Value of the collected digits. */
+  uint64_t collected;
+  /* Amount of collected digits. */
+  int      collectedDigits;
+} DecimalSignificand;
+
+/* Add the given digit to the end of the given significand. */
+static void appendDecimalDigit(DecimalSignificand* target, int appended) {
+  if (target->collectedDigits == LIMB_DIGIT_LIMIT) {
+    multiplyAndAddLimbs(
+      &target->limbs, LIMB_POWERS_OF_TEN[LIMB_DIGIT_LIMIT], target->collected);
+    target->collected       = 0;
+    target->collectedDigits = 0;
+  }
+  target->collected = target->collected * DECIMAL_BASE + appended;
+  target->collectedDigits++;
+}
 
 Number parseDecimal(String parsedDecimal) {
   // Check the parsed character limit.
   if (countCharacters(parsedDecimal) > PARSED_DIGIT_LIMIT) {
     return (Number){
-      .significand = createBuffer(0),
-      .exponent    = 0,
-      .flag        = NUMBER_TOO_PRECISE};
+      .significand      = createLimbs(0),
+      .smallSignificand = 0,
+      .exponent         = 0,
+      .flag             = NUMBER_TOO_PRECISE};
   }
 
-  bool afterDot = false;
+  DecimalSignificand significand = {
+    .limbs = createLimbs(0), .collected = 0, .collectedDigits = 0};
+  int         exponent = 0;
+  // Zeros that are not added to the significand yet, which might be trailing.
+  int         zeros    = 0;
+  bool        afterDot = false;
+  char const* digit    = parsedDecimal.first;
+
+  for (; digit < parsedDecimal.after; digit++) {
+    if (*digit == 'e' || *digit == 'E') break;
+    if (*digit == '.') afterDot = true;
+    if (*digit == '.' || *digit == '_') continue;
+
+    // Digits after the dot scale down the number.
+    if (afterDot) exponent--;
+
+    // Leading zeros are not significant, and the other zeros are added when a
+    // nonzero digit comes after them.
+    if (*digit == '0') {
+      zeros += significand.collectedDigits > 0;
+      continue;
+    }
+    for (; zeros > 0; zeros--) appendDecimalDigit(&significand, 0);
+    appendDecimalDigit(&significand, *digit - '0');
+  }
+  exponent += zeros;
+
+  // If the number is zero, skip the exponent.
+  if (!significand.collectedDigits) exponent = 0;
+  else if (digit < parsedDecimal.after) {
+    // Skip 'e' or 'E', and consume the sign character.
+    digit++;
+    bool negative = *digit == '-';
+    if (negative || *digit == '+') digit++;
+
+    int parsedExponent = 0;
+    for (; digit < parsedDecimal.after; digit++) {
+      if (*digit == '_') continue;
+      parsedExponent = parsedExponent * EXPONENT_BASE + (*digit - '0');
+
+      // If the exponent is at the limit, the number is zero or infinite
+      // depending on the sign of the exponent.
+      if (parsedExponent >= EXPONENT_LIMIT) {
+        disposeLimbs(&significand.limbs);
+        return (Number){
+          .significand      = createLimbs(0),
+          .smallSignificand = 0,
+          .exponent         = 0,
+          .flag             = negative ? NUMBER_ZERO : NUMBER_INFINITE};
+      }
+    }
+    exponent += negative ? -parsedExponent : parsedExponent;
+  }
 
-  // Create a number with zero in it.
+  // Numbers that fit in a limb are small.
+  if (!countLimbs(significand.limbs)) {
+    return (Number){
+      .significand      = significand.limbs,
+      .smallSignificand = significand.collected,
+      .exponent         = exponent,
+      .flag             = NUMBER_SMALL};
+  }
+
+  multiplyAndAddLimbs(
+    &significand.limbs, LIMB_POWERS_OF_TEN[significand.collectedDigits],
+    significand.collected);
   Number decimal = {
-    .significand = createBuffer(1), .exponent = 0, .flag = NUMBER_NORMAL};
-  appendCharacter(&decimal.significand, 0);
-
-  for (char const* digit = parsedDecimal.first; digit < parsedDecimal.after;
-       digit++) {
-    switch (*digit) {
-    case '.': afterDot = true;
-    case '_': continue;
-    case 'e':
-    case 'E':
-      // If the number is zero, skip any exponent checks.
-      if (countBytes(decimal.significand) == 1 && !*decimal.significand.first)
-        goto success;
-
-      // Skip 'e' or 'E' before parsing the exponent.
-      Number exponent =
-        parseExponent(createString(digit + 1, parsedDecimal.after));
-      decimal.exponent += exponent.exponent;
-      decimal.flag = exponent.flag;
-      disposeNumber(&exponent);
-
-      // Check the exponent after parsed exponent was added. No need to check
-      // the upper bound as the initial exponent is always non-positive and the
-      // parsed exponent is always below the maximum limit.
-      if (decimal.exponent <= -EXPONENT_LIMIT) decimal.flag = NUMBER_ZERO;
-      if (decimal.flag != NUMBER_NORMAL) return decimal;
-
-      goto success;
-    default:
-      if (afterDot) decimal.exponent--;
-      multiplySignificand(&decimal.significand, DECIMAL_BASE);
-      addToSignificand(&decimal.significand, *digit - '0');
+    .significand      = significand.limbs,
+    .smallSignificand = 0,
+    .exponent         = exponent,
+    .flag             = NUMBER_NORMAL};
+
+  // Check the exponent after parsed exponent was added. No need to check the
+  // upper bound as the parsed exponent is always below the limit, and the
+  // digits after the dot only lower it.
+  if (decimal.exponent <= -EXPONENT_LIMIT) decimal.flag = NUMBER_ZERO;
+  else rebaseNumber(&decimal);
+  return decimal;
+}
+
+void disposeNumber(Number* disposed) { disposeLimbs(&disposed->significand); }
+
+/* Convert the given integer with the given sign into the given arithmetic value
+ * of the given integer destination type. Returns the conversion result. */
+static NumberConversionResult convertIntegerToArithmetic(
+  Type destination, Value* target, uint64_t converted, bool negativeSign) {
+  uint64_t maximum = getMaximumValue(destination);
+
+  // Check whether the destination is signed.
+  if (checkSignedness(destination)) {
+    // A valid signed number can be smaller than the maximum, or it can be equal
+    // to one plus the maximum if its negative, because in the two's complement
+    // representation the positive numbers contain the `0` value and they have
+    // one less limit because of that.
+    if (converted > maximum + 1 || (converted == maximum + 1 && !negativeSign))
+      return NUMBER_CONVERSION_OUT_OUF_BOUNDS;
+
+    *target = convertSignedArithmetic(
+      destination, negativeSign ? -(int64_t)converted : (int64_t)converted);
+    return NUMBER_CONVERSION_SUCCESS;
+  }
+
+  // Compare to the maximum value.
+  if (converted > maximum) return NUMBER_CONVERSION_OUT_OUF_BOUNDS;
+
+  // The sign can only be negative if the value is zero.
+  if (negativeSign && converted != 0) return NUMBER_CONVERSION_NOT_UNSIGNED;
+
+  *target = convertUnsignedArithmetic(destination, converted);
+  return NUMBER_CONVERSION_SUCCESS;
+}
+
+/* Convert the given small number with the given sign into the given arithmetic
+ * value of the given integer destination type. Returns the conversion
+ * result. */
+static NumberConversionResult convertSmallToInteger(
+  Type destination, Value* target, Number converted, bool negativeSign) {
+  uint64_t value    = converted.smallSignificand;
+  int      exponent = converted.exponent;
+
+  // Remove the zeros that are after the dot.
+  for (; exponent < 0 && value % DECIMAL_BASE == 0; exponent++)
+    value /= DECIMAL_BASE;
+  if (exponent < 0) return NUMBER_CONVERSION_NOT_INTEGER;
+
+  // Scale up the value while it fits in 64 bits.
+  for (; exponent > 0; exponent--) {
+    if (value > UINT64_MAX / DECIMAL_BASE)
+      return NUMBER_CONVERSION_OUT_OUF_BOUNDS;
+    value *= DECIMAL_BASE;
+  }
+
+  return convertIntegerToArithmetic(destination, target, value, negativeSign);
+}
+
+/* Powers of 10 that are exactly representable as doubles. */
+static double const EXACT_POWERS_OF_TEN[] = {
+  1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+  1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+/* Largest exponent of 10 that is exactly representable as a float. */
+#define FLOAT_EXACT_POWER_LIMIT 10
+/* Largest exponent of 10 that is exactly representable as a double. */
+#define DOUBLE_EXACT_POWER_LIMIT \
+  (sizeof(EXACT_POWERS_OF_TEN) / sizeof(double) - 1)
+
+/* Layout of a binary real, and the exponents of 10 where the approximation of
+ * a small number is done differently. */
+typedef struct {
+  /* Amount of bits that are reserved for the significand. */
+  int mantissaWidth;
+  /* Amount of bits that are reserved for the exponent. */
+  int exponentWidth;
+  /* Smallest exponent of 10 where a small number might not be zero. */
+  int smallestPower;
+  /* Largest exponent of 10 where a small number might not be infinite. */
+  int largestPower;
+  /* Smallest exponent of 10 where a small number might be exactly between two
+   * reals. */
+  int smallestTiePower;
+  /* Largest exponent of 10 where a small number might be exactly between two
+   * reals. */
+  int largestTiePower;
+} RealFormat;
+
+/* Layout of floats. */
+static RealFormat const FLOAT_FORMAT = {
+  .mantissaWidth    = FLOAT_MANTISSA_WIDTH,
+  .exponentWidth    = FLOAT_EXPONENT_WIDTH,
+  .smallestPower    = -65,
+  .largestPower     = 38,
+  .smallestTiePower = -17,
+  .largestTiePower  = 10};
+/* Layout of doubles. */
+static RealFormat const DOUBLE_FORMAT = {
+  .mantissaWidth    = DOUBLE_MANTISSA_WIDTH,
+  .exponentWidth    = DOUBLE_EXPONENT_WIDTH,
+  .smallestPower    = POWER_TABLE_MINIMUM,
+  .largestPower     = POWER_TABLE_MAXIMUM,
+  .smallestTiePower = -4,
+  .largestTiePower  = 23};
+
+/* Bits of the real in the given format that is nearest to the given small
+ * number, which is found with the Eisel-Lemire algorithm. The significand is
+ * multiplied with the most significant bits of the power of 10, which is
+ * enough to round correctly unless the product is too close to a tie. Returns
+ * false if the product cannot decide the rounding. */
+static bool
+approximateSmallReal(Number approximated, RealFormat format, uint64_t* bits) {
+  uint64_t significand = approximated.smallSignificand;
+  int      exponent    = approximated.exponent;
+  int      infinite    = (1 << format.exponentWidth) - 1;
+  if (!significand || exponent < format.smallestPower) {
+    *bits = 0;
+    return true;
+  }
+  if (exponent > format.largestPower) {
+    *bits = (uint64_t)infinite << format.mantissaWidth;
+    return true;
+  }
+
+  // Multiply the normalized significand with the power of 10, which is the
+  // power of 5 with an exponent of 2 that is added later. Mantissa, its
+  // implicit bit, a bit for rounding and a bit for the place of the most
+  // significant bit are kept. The product with the least significant limb of
+  // the power is only needed when all the bits below the kept ones are set,
+  // as it can only carry into them.
+  int      leadingZeros = (int)countLeadingZeros(significand);
+  uint64_t normalized   = significand << leadingZeros;
+  size_t   place        = exponent - POWER_TABLE_MINIMUM;
+  int      kept         = format.mantissaWidth + 3;
+  uint64_t below        = UINT64_MAX >> kept;
+  uint64_t high;
+  uint64_t low = multiplyLimb(normalized, powersOfFive[place][0], &high);
+  if ((high & below) == below) {
+    uint64_t secondHigh;
+    multiplyLimb(normalized, powersOfFive[place][1], &secondHigh);
+    low += secondHigh;
+    high += low < secondHigh;
+  }
+
+  // Product is still truncated, which can be a problem when it is too close to
+  // the next one. Powers that fit in two limbs are exact, and the error is
+  // small enough for the reciprocals of the ones that fit in a limb.
+  if (
+    low == UINT64_MAX &&
+    (exponent < -LIMB_FIVE_POWER_LIMIT || exponent > WIDE_FIVE_POWER_LIMIT))
+    return false;
+
+  // Exponent of 2 in the power of 10 is approximated as the floor of the
+  // exponent times the logarithm of 10 in base 2, which is kept with a 16-bit
+  // fraction. Then, the exponent is biased and adjusted to the place of the
+  // most significant bit of the product.
+  int      upper    = (int)(high >> (LIMB_BITS - 1));
+  int      shift    = upper + (int)LIMB_BITS - kept;
+  uint64_t mantissa = high >> shift;
+  int      bias     = infinite / 2;
+  int      biased   = ((217706 * exponent) >> 16) + (int)LIMB_BITS - 1 + upper -
+               leadingZeros + bias;
+
+  // Subnormals are shifted to the smallest exponent, and cannot be ties. When
+  // rounding carries into the implicit bit, the result is the smallest normal
+  // real, which the bits already show.
+  if (biased <= 0) {
+    if (1 - biased >= (int)LIMB_BITS) {
+      *bits = 0;
+      return true;
     }
+    mantissa >>= 1 - biased;
+    *bits = (mantissa + (mantissa & 1)) >> 1;
+    return true;
   }
 
-success:
-  rebaseNumber(&decimal, DECIMAL_BASE);
-  return decimal;
+  // Round to the nearest, which is done by adding the rounding bit. When the
+  // product is exactly at a tie, it is rounded to the even one instead, which
+  // is only possible for the powers that are around zero.
+  if (
+    low <= 1 && exponent >= format.smallestTiePower &&
+    exponent <= format.largestTiePower && (mantissa & 3) == 1 &&
+    mantissa << shift == high)
+    mantissa &= ~(uint64_t)1;
+  mantissa = (mantissa + (mantissa & 1)) >> 1;
+
+  // Rounding might carry into the next power of 2.
+  if (mantissa >= (uint64_t)2 << format.mantissaWidth) {
+    mantissa >>= 1;
+    biased++;
+  }
+  mantissa &= ~((uint64_t)1 << format.mantissaWidth);
+  if (biased >= infinite) {
+    *bits = (uint64_t)infinite << format.mantissaWidth;
+    return true;
+  }
+  *bits = (uint64_t)biased << format.mantissaWidth | mantissa;
+  return true;
 }
 
-void disposeNumber(Number* disposed) { disposeBuffer(&disposed->significand); }
+/* Convert the given small number into the given real. Returns false if the
+ * number cannot be converted without the infinite precision. */
+static bool
+convertSmallToReal(Type destination, Value* target, Number converted) {
+  bool     isFloat     = compareTypeEquality(destination, FLOAT_TYPE_INSTANCE);
+  uint64_t significand = converted.smallSignificand;
+  int      exponent    = converted.exponent;
+
+  // Largest significand and power of 10 that are exact in the real.
+  size_t   width      = isFloat ? FLOAT_MANTISSA_WIDTH : DOUBLE_MANTISSA_WIDTH;
+  uint64_t exactLimit = (uint64_t)1 << (width + 1);
+  size_t   powerLimit =
+    isFloat ? FLOAT_EXACT_POWER_LIMIT : DOUBLE_EXACT_POWER_LIMIT;
+
+  // Move the exponent into the significand while the significand stays exact.
+  for (; exponent > 0 && significand <= exactLimit / DECIMAL_BASE; exponent--)
+    significand *= DECIMAL_BASE;
+
+  // Integers that fit in 64 bits are rounded once by the conversion.
+  uint64_t integer         = significand;
+  int      integerExponent = exponent;
+  for (; integerExponent > 0 && integer <= UINT64_MAX / DECIMAL_BASE;
+       integerExponent--)
+    integer *= DECIMAL_BASE;
+  if (!integerExponent) {
+    if (isFloat) target->asFloat = (float)integer;
+    else target->asDouble = (double)integer;
+    return true;
+  }
+
+  // When the significand and the power of 10 are both exact, a single
+  // multiplication or division rounds the result correctly.
+  size_t power = exponent < 0 ? -exponent : exponent;
+  if (significand <= exactLimit && power <= powerLimit) {
+    if (isFloat) {
+      float scale = (float)EXACT_POWERS_OF_TEN[power];
+      target->asFloat =
+        exponent < 0 ? (float)significand / scale : (float)significand * scale;
+    } else {
+      double scale     = EXACT_POWERS_OF_TEN[power];
+      target->asDouble = exponent < 0 ? (double)significand / scale
+                                      : (double)significand * scale;
+    }
+    return true;
+  }
+
+  // Otherwise, approximate the product with the power of 10.
+  uint64_t bits;
+  if (!approximateSmallReal(
+        converted, isFloat ? FLOAT_FORMAT : DOUBLE_FORMAT, &bits))
+    return false;
+  if (isFloat) target->asFloat = reinterpretFloat((uint32_t)bits);
+  else target->asDouble = reinterpretDouble(bits);
+  return true;
+}
+
+/* Convert the given infinite precision number into the given real. */
+static void
+convertNumberToReal(Type destination, Value* target, Number converted) {
+  if (compareTypeEquality(destination, FLOAT_TYPE_INSTANCE))
+    target->asFloat = convertNumberToFloat(converted);
+  else target->asDouble = convertNumberToDouble(converted);
+}
+
+/* Infinite precision number that has the same value as the given small
+ * number. */
+static Number expandSmallNumber(Number expanded) {
+  Number number = {
+    .significand      = createLimbs(1),
+    .smallSignificand = 0,
+    .exponent         = expanded.exponent,
+    .flag             = NUMBER_NORMAL};
+  pushLimb(&number.significand, expanded.smallSignificand);
+  rebaseNumber(&number);
+  return number;
+}
 
 NumberConversionResult convertNumberToArithmetic(
   Type destination, Value* target, Number converted, bool negativeSign) {
   // Check whether the destination is an integer.
   if (checkIntegerness(destination)) {
+    if (converted.flag == NUMBER_SMALL)
+      return convertSmallToInteger(
+        destination, target, converted, negativeSign);
+
     // Check whether the converted number is integer.
     if (!checkNumberIntegerness(converted))
       return NUMBER_CONVERSION_NOT_INTEGER;
 
-    // Check whether the destination is signed.
-    if (checkSignedness(destination)) {
-      // Compare to one plus the maximum value because in the two's complement
-      // representation the positive numbers contain the `0` value and they have
-      // one less limit because of that.
-      int comparison =
-        compareNumber(converted, getMaximumValue(destination) + 1);
-
-      // A valid signed number can be smaller than the maximum, or it can be
-      // equal to maximum if its negative. Thus, if it is bigger than the
-      // maximum, or it equals to the maximum but it is not negative, it is out
-      // of bounds.
-      if (comparison == 1 || (comparison == 0 && !negativeSign))
-        return NUMBER_CONVERSION_OUT_OUF_BOUNDS;
-
-      *target = convertSignedArithmetic(
-        destination,
-        (negativeSign ? -1 : 1) * (int64_t)convertNumberToInteger(converted));
-    } else {
-      // Compare to the maximum value.
-      if (compareNumber(converted, getMaximumValue(destination)) == 1)
-        return NUMBER_CONVERSION_OUT_OUF_BOUNDS;
-
-      // The sign can only be negative if the value is zero.
-      uint64_t value = convertNumberToInteger(converted);
-      if (negativeSign && value != 0) return NUMBER_CONVERSION_NOT_UNSIGNED;
-
-      *target = convertUnsignedArithmetic(destination, value);
-    }
-
-    return NUMBER_CONVERSION_SUCCESS;
+    // Numbers that do not fit in 64 bits are out of bounds of any integer.
+    if (!checkNumberFitting(converted)) return NUMBER_CONVERSION_OUT_OUF_BOUNDS;
+    return convertIntegerToArithmetic(
+      destination, target, convertNumberToInteger(converted), negativeSign);
   }
 
   // If the destination is not an integer, it can only be a float or double.
-  if (compareTypeEquality(destination, FLOAT_TYPE_INSTANCE))
-    target->asFloat = convertNumberToFloat(converted);
-  else target->asDouble = convertNumberToDouble(converted);
+  // Small numbers are expanded only if they cannot be converted directly.
+  if (converted.flag != NUMBER_SMALL)
+    convertNumberToReal(destination, target, converted);
+  else if (!convertSmallToReal(destination, target, converted)) {
+    Number expanded = expandSmallNumber(converted);
+    convertNumberToReal(destination, target, expanded);
+    disposeNumber(&expanded);
+  }
+
+  // Apply the sign, which is not in the number.
+  if (negativeSign && compareTypeEquality(destination, FLOAT_TYPE_INSTANCE))
+    target->asFloat = -target->asFloat;
+  else if (negativeSign) target->asDouble = -target->asDouble;
   return NUMBER_CONVERSION_SUCCESS;
 }
@@ -7,21 +7,21 @@
 #include "source/api.h"
 #include "utility/api.h"
 
-Table createTable(Source* reported, Parse analyzed) {
-  Table created = {.first = NULL, .after = NULL, .bound = NULL};
-  analyzeParse(&created, reported, analyzed);
+#include <stdbool.h>
+
+void initAnalyzer() { initNumbers(); }
+
+Table createTable(Source* reported, Parse analyzed, bool verbose) {
+  Table created = {
+    .first = NULL, .after = NULL, .bound = NULL, .evaluations = createArena()};
+  analyzeParse(&created, reported, analyzed, verbose);
   return created;
 }
 
 void disposeTable(Table* disposed) {
-  for (Symbol* symbol = disposed->first; symbol < disposed->after; symbol++) {
-    switch (symbol->tag) {
-    case SYMBOL_BINDING: disposeEvaluation(&symbol->asBinding.bound); break;
-    case SYMBOL_VARIABLE: disposeEvaluation(&symbol->asVariable.initial); break;
-    case SYMBOL_TYPE: break;
-    default: unexpected("Unknown symbol variant!");
-    }
-  }
+  // Evaluations of all the symbols are released with their arena, without
+  // going through the symbols.
+  disposeArena(&disposed->evaluations);
   disposed->first = allocateArray(disposed->first, 0, Symbol);
   disposed->after = disposed->first;
   disposed->bound = disposed->first;
@@ -88,8 +88,9 @@ bool checkSignedness(Type checked) {
 Type findCombination(Type left, Type right) {
   // The arithmetic type that could be the destination of conversion from the
   // other one should be the type of a binary expresison that has operands of
-  // the given arithmetic types.
-  return !checkArithmeticConvertability(left, right) ? left : right;
+  // the given arithmetic types. Every type converts to bool as a truth value,
+  // which does not make bool wider; thus, only the order of the types is used.
+  return left.tag > right.tag ? left : right;
 }
 
 char const* nameType(Type named) {
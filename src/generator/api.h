@@ -5,5 +5,9 @@
 
 #include "analyzer/api.h"
 
-/* Generate the C file with the symbols in the given table. */
-void generateTable(Table generated);
+#include <time.h>
+
+/* Generate the C file at the given path with the symbols in the given table.
+ * Generated file is stamped with the given local date and time. */
+void generateTable(
+  Table generated, char const* generatedPath, struct tm generatedDateTime);
@@ -4,22 +4,47 @@
 #include "analyzer/api.h"
 #include "analyzer/mod.h"
 #include "generator/api.h"
+#include "lexer/api.h"
 #include "parser/api.h"
 #include "utility/api.h"
 
 #include <float.h>
+#include <limits.h>
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdio.h>
 #include <time.h>
 
+/* Evaluation node whose operands are being generated. */
+typedef struct {
+  /* Generated node. */
+  EvaluationNode generated;
+  /* Amount of operands that were generated. */
+  size_t         generatedOperands;
+} PendingNode;
+
+/* Dynamic array of pending nodes, which is used as a stack. */
+typedef struct {
+  /* Pointer to the first pending node if it exists. */
+  PendingNode* first;
+  /* Pointer to one after the last pending node. */
+  PendingNode* after;
+  /* Pointer to one after the last allocated pending node. */
+  PendingNode* bound;
+} PendingNodes;
+
 /* Context of the generation process. */
 typedef struct {
   /* Stream to write the symbols into. */
-  FILE* target;
+  FILE*        target;
   /* Generated table. */
-  Table generated;
+  Table        generated;
   /* Amount of indentation to generate. */
-  int   indentation;
+  int          indentation;
+  /* Nodes whose operands are being generated. */
+  PendingNodes pending;
+  /* Local date and time the file is generated at. */
+  struct tm    dateTime;
 } Context;
 
 /* Generate a new line. */
@@ -83,7 +108,12 @@ generateValue(Context* context, Type generatedType, Value generatedValue) {
     fprintf(context->target, "'%c'", generatedValue.asByte);
     break;
   case TYPE_INT: fprintf(context->target, "%i", generatedValue.asInt); break;
-  case TYPE_UXS: fprintf(context->target, "%zu", generatedValue.asUxs); break;
+  case TYPE_UXS:
+    // Decimal literals that do not fit into a long long do not have a type in
+    // C, unless they are suffixed as unsigned.
+    fprintf(context->target, "%zu", generatedValue.asUxs);
+    if (generatedValue.asUxs > LLONG_MAX) fputc('u', context->target);
+    break;
   case TYPE_FLOAT:
     fprintf(context->target, "%.*g", FLT_DECIMAL_DIG, generatedValue.asFloat);
     break;
@@ -95,112 +125,138 @@ generateValue(Context* context, Type generatedType, Value generatedValue) {
   }
 }
 
-/* Generate the given evaluation node and move the pointer to the node after all
- * the childeren of this one. Does not generate but moves the pointer if the
- * flag is true. */
-static void
-generateNode(Context* context, EvaluationNode const** pointer, bool justPass) {
-  if (!justPass) fputc('(', context->target);
-  EvaluationNode generated = **pointer;
-  (*pointer)--;
+/* Generate the part of the given evaluation node that comes after the given
+ * amount of its operands, which ends at the next operand or the end of the
+ * node. Returns whether there is an operand after the generated part. */
+static bool generateNodePart(
+  Context* context, EvaluationNode generated, size_t generatedOperands) {
   switch (getOperator(generated.evaluated.operator).tag) {
   case OPERATOR_NULLARY:
     switch (generated.evaluated.operator) {
-    case SYMBOL_ACCESS:
-      if (!justPass)
-        fprintf(
-          context->target, "%.*s",
-          (int)countCharacters(generated.evaluated.section),
-          generated.evaluated.section.first);
-      break;
+    case SYMBOL_ACCESS: {
+      String name = nameIdentifier(generated.evaluated.identifier);
+      fprintf(context->target, "%.*s", (int)countCharacters(name), name.first);
+      return false;
+    }
     case DECIMAL_LITERAL:
-      if (!justPass)
-        generateValue(context, generated.object.type, generated.object.value);
-      break;
+      generateValue(context, generated.object.type, generated.object.value);
+      return false;
     default: unexpected("Unknown nullary operator!");
     }
-    break;
   case OPERATOR_PRENARY:
-    if (!justPass) switch (generated.evaluated.operator) {
-      case POSATE: fputc('+', context->target); break;
-      case NEGATE: fputc('-', context->target); break;
-      case LOGICAL_NOT: fputc('!', context->target); break;
-      case COMPLEMENT: fputc('~', context->target); break;
-      case PREFIX_INCREMENT: fputs("++", context->target); break;
-      case PREFIX_DECREMENT: fputs("--", context->target); break;
-      default: unexpected("Unknown prenary operator!");
-      }
-    generateNode(context, pointer, justPass);
-    break;
+    if (generatedOperands) return false;
+    switch (generated.evaluated.operator) {
+    case POSATE: fputc('+', context->target); break;
+    case NEGATE: fputc('-', context->target); break;
+    case LOGICAL_NOT: fputc('!', context->target); break;
+    case COMPLEMENT: fputc('~', context->target); break;
+    case PREFIX_INCREMENT: fputs("++", context->target); break;
+    case PREFIX_DECREMENT: fputs("--", context->target); break;
+    default: unexpected("Unknown prenary operator!");
+    }
+    return true;
   case OPERATOR_POSTARY:
-    generateNode(context, pointer, justPass);
-    if (!justPass) switch (generated.evaluated.operator) {
-      case POSTFIX_INCREMENT: fputs("++", context->target); break;
-      case POSTFIX_DECREMENT: fputs("--", context->target); break;
-      default: unexpected("Unknown postary operator!");
-      }
-    break;
+    if (!generatedOperands) return true;
+    switch (generated.evaluated.operator) {
+    case POSTFIX_INCREMENT: fputs("++", context->target); break;
+    case POSTFIX_DECREMENT: fputs("--", context->target); break;
+    default: unexpected("Unknown postary operator!");
+    }
+    return false;
   case OPERATOR_CIRNARY:
     switch (generated.evaluated.operator) {
     case GROUP:
-      if (!justPass) fputc('(', context->target);
-      generateNode(context, pointer, justPass);
-      if (!justPass) fputc(')', context->target);
-      break;
+      fputc(generatedOperands ? ')' : '(', context->target);
+      return !generatedOperands;
     default: unexpected("Unknown cirnary operator!");
     }
-    break;
   case OPERATOR_BINARY:
-    generateNode(context, pointer, justPass);
-    if (!justPass) switch (generated.evaluated.operator) {
-      case MULTIPLICATION: fputc('*', context->target); break;
-      case DIVISION: fputc('/', context->target); break;
-      case REMINDER: fputc('%', context->target); break;
-      case ADDITION: fputc('+', context->target); break;
-      case SUBTRACTION: fputc('-', context->target); break;
-      case LEFT_SHIFT: fputs("<<", context->target); break;
-      case RIGHT_SHIFT: fputs(">>", context->target); break;
-      case BITWISE_AND: fputc('&', context->target); break;
-      case BITWISE_XOR: fputc('^', context->target); break;
-      case BITWISE_OR: fputc('|', context->target); break;
-      case SMALLER_THAN: fputc('<', context->target); break;
-      case SMALLER_THAN_OR_EQUAL_TO: fputs("<=", context->target); break;
-      case GREATER_THAN: fputc('>', context->target); break;
-      case GREATER_THAN_OR_EQUAL_TO: fputs(">=", context->target); break;
-      case EQUAL_TO: fputs("==", context->target); break;
-      case NOT_EQUAL_TO: fputs("!=", context->target); break;
-      case LOGICAL_AND: fputs("&&", context->target); break;
-      case LOGICAL_OR: fputs("||", context->target); break;
-      case ASSIGNMENT: fputc('=', context->target); break;
-      case MULTIPLICATION_ASSIGNMENT: fputs("*=", context->target); break;
-      case DIVISION_ASSIGNMENT: fputs("=/", context->target); break;
-      case REMINDER_ASSIGNMENT: fputs("%=", context->target); break;
-      case ADDITION_ASSIGNMENT: fputs("+=", context->target); break;
-      case SUBTRACTION_ASSIGNMENT: fputs("-=", context->target); break;
-      case LEFT_SHIFT_ASSIGNMENT: fputs("<<=", context->target); break;
-      case RIGHT_SHIFT_ASSIGNMENT: fputs(">>=", context->target); break;
-      case BITWISE_AND_ASSIGNMENT: fputs("&=", context->target); break;
-      case BITWISE_XOR_ASSIGNMENT: fputs("^=", context->target); break;
-      case BITWISE_OR_ASSIGNMENT: fputs("|=", context->target); break;
-      default: unexpected("Unknown binary operator!");
-      }
-    generateNode(context, pointer, justPass);
-    break;
+    // Operator goes between the left and right operands.
+    if (generatedOperands != 1) return !generatedOperands;
+    switch (generated.evaluated.operator) {
+    case MULTIPLICATION: fputc('*', context->target); break;
+    case DIVISION: fputc('/', context->target); break;
+    case REMINDER: fputc('%', context->target); break;
+    case ADDITION: fputc('+', context->target); break;
+    case SUBTRACTION: fputc('-', context->target); break;
+    case LEFT_SHIFT: fputs("<<", context->target); break;
+    case RIGHT_SHIFT: fputs(">>", context->target); break;
+    case BITWISE_AND: fputc('&', context->target); break;
+    case BITWISE_XOR: fputc('^', context->target); break;
+    case BITWISE_OR: fputc('|', context->target); break;
+    case SMALLER_THAN: fputc('<', context->target); break;
+    case SMALLER_THAN_OR_EQUAL_TO: fputs("<=", context->target); break;
+    case GREATER_THAN: fputc('>', context->target); break;
+    case GREATER_THAN_OR_EQUAL_TO: fputs(">=", context->target); break;
+    case EQUAL_TO: fputs("==", context->target); break;
+    case NOT_EQUAL_TO: fputs("!=", context->target); break;
+    case LOGICAL_AND: fputs("&&", context->target); break;
+    case LOGICAL_OR: fputs("||", context->target); break;
+    case ASSIGNMENT: fputc('=', context->target); break;
+    case MULTIPLICATION_ASSIGNMENT: fputs("*=", context->target); break;
+    case DIVISION_ASSIGNMENT: fputs("=/", context->target); break;
+    case REMINDER_ASSIGNMENT: fputs("%=", context->target); break;
+    case ADDITION_ASSIGNMENT: fputs("+=", context->target); break;
+    case SUBTRACTION_ASSIGNMENT: fputs("-=", context->target); break;
+    case LEFT_SHIFT_ASSIGNMENT: fputs("<<=", context->target); break;
+    case RIGHT_SHIFT_ASSIGNMENT: fputs(">>=", context->target); break;
+    case BITWISE_AND_ASSIGNMENT: fputs("&=", context->target); break;
+    case BITWISE_XOR_ASSIGNMENT: fputs("^=", context->target); break;
+    case BITWISE_OR_ASSIGNMENT: fputs("|=", context->target); break;
+    default: unexpected("Unknown binary operator!");
+    }
+    return true;
   case OPERATOR_VARIARY:
     switch (generated.evaluated.operator) {
     case FUNCTION_CALL: unexpected("Not implemented!");
     default: unexpected("Unknown variary operator!");
     }
-    break;
   default: unexpected("Unknown operator variant!");
   }
-  if (!justPass) fputc(')', context->target);
 }
 
-/* Generate the given evaluation. */
+/* Start generating the evaluation node at the given pointer, and move the
+ * pointer to the node before it. Operations with known values are generated as
+ * literals; thus, the pointer is moved before all of their operands. */
+static void enterNode(Context* context, EvaluationNode const** pointer) {
+  EvaluationNode entered = **pointer;
+  (*pointer)--;
+  fputc('(', context->target);
+  if (!entered.object.known || !entered.evaluated.arity) {
+    reserveArray(&context->pending, 1, PendingNode);
+    *context->pending.after++ =
+      (PendingNode){.generated = entered, .generatedOperands = 0};
+    return;
+  }
+
+  generateValue(context, entered.object.type, entered.object.value);
+  fputc(')', context->target);
+
+  // Skip the operands, which come before the node with their own operands.
+  for (size_t skipped = entered.evaluated.arity; skipped > 0; skipped--) {
+    skipped += (*pointer)->evaluated.arity;
+    (*pointer)--;
+  }
+}
+
+/* Generate the given evaluation. Nodes whose operands are being generated are
+ * kept in the pending nodes instead of the call stack; thus, the depth of
+ * nesting only costs memory. */
 static void generateEvaluation(Context* context, Evaluation generated) {
-  EvaluationNode const* start = generated.after - 1;
-  generateNode(context, &start, false);
+  EvaluationNode const* pointer = generated.after - 1;
+  enterNode(context, &pointer);
+
+  // Operands come before their node in the evaluation, and the left operand
+  // comes right before the node.
+  while (context->pending.after > context->pending.first) {
+    PendingNode* top = context->pending.after - 1;
+    if (generateNodePart(context, top->generated, top->generatedOperands++)) {
+      enterNode(context, &pointer);
+      continue;
+    }
+    fputc(')', context->target);
+    context->pending.after--;
+  }
 }
 
 /* Generate the given symbol. */
@@ -236,8 +292,7 @@ static void generateSymbol(Context* context, Symbol generated) {
 
 /* Run the generator with the given context. */
 static void generate(Context* context) {
-  time_t    now           = time(NULL);
-  struct tm localDateTime = *localtime(&now);
+  struct tm localDateTime = context->dateTime;
   fprintf(
     context->target,
     "// Generated by Rainfall-c on %i.%02i.%02i at %02i.%02i.%02i.",
@@ -274,16 +329,23 @@ static void generate(Context* context) {
   generateNewLine(context);
 }
 
-void generateTable(Table generated) {
+void generateTable(
+  Table generated, char const* generatedPath, struct tm generatedDateTime) {
   // Open the target file that will be generated.
-  FILE* target = fopen("build.c", "w");
+  FILE* target = fopen(generatedPath, "w");
   expect(target, "Could not open the generated file!");
 
-  // Create a context and pass its pointer, because all functions take a context
-  // pointer and this removes the need for taking the address of the context in
-  // the main generation function.
-  generate(
-    &(Context){.target = target, .generated = generated, .indentation = 0});
+  // Pending nodes are kept in the context, so that their memory is reused by
+  // all the evaluations.
+  Context context = {
+    .target      = target,
+    .generated   = generated,
+    .indentation = 0,
+    .pending     = {.first = NULL, .after = NULL, .bound = NULL},
+    .dateTime    = generatedDateTime
+  };
+  generate(&context);
+  allocateArray(context.pending.first, 0, PendingNode);
 
   expect(fclose(target) == 0, "Could not close the generated file!");
 }
@@ -6,6 +6,10 @@
 #include "source/api.h"
 #include "utility/api.h"
 
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
 /* Variant of a lexeme. */
 typedef enum {
   /* Mark ",". */
@@ -104,23 +108,95 @@ typedef struct {
   String    section;
   /* Variant of the lexeme. */
   LexemeTag tag;
+  /* Interned identifier if the lexeme is an identifier. Same names have the
+   * same identifier in all the source files. */
+  uint32_t  identifier;
 } Lexeme;
 
-/* Result of lexing a source file. */
+/* Result of lexing a source file. Lexemes are not stored as a whole; their
+ * tags, starts and lengths are in separate arrays, which keeps them compact
+ * and makes scanning the tags dense. */
 typedef struct {
-  /* Pointer to the first lexeme if it exists. */
-  Lexeme* first;
-  /* Pointer to one after the last lexeme. */
-  Lexeme* after;
-  /* Pointer to one after the last allocated lexeme. */
-  Lexeme* bound;
+  /* Start of the contents of the lexed source, which lexemes start from. */
+  char const* contents;
+  /* Pointer to the variant of the first lexeme if it exists. */
+  uint8_t*    tags;
+  /* Pointer to the offset of the first lexeme from the contents. */
+  uint32_t*   starts;
+  /* Pointer to the amount of characters in the first lexeme. */
+  uint32_t*   lengths;
+  /* Amount of lexemes. */
+  size_t      count;
+  /* Amount of lexemes there is space for. */
+  size_t      capacity;
 } Lex;
 
+/* Amount of lexemes that are kept by a lexeme stream. Must be a power of two,
+ * and at least 3 for having the previous, current and next lexemes. */
+#define LEXEME_WINDOW 4
+
+/* Lexemes of a source file that are lexed on demand. Only the last lexed ones
+ * are kept; thus, the used memory does not grow with the file size. */
+typedef struct {
+  /* Lexed source. */
+  Source*     source;
+  /* Position of the currently lexed character. */
+  char const* current;
+  /* Position after the last character to lex. */
+  char const* after;
+  /* Whether the last lexed characters were a word, a decimal or an unknown
+   * portion, which must be followed by a separator. Then, a sign is always a
+   * mark instead of the start of a decimal. */
+  bool        joined;
+  /* Lexemes of the whole file if it is lexed at once, which are taken instead
+   * of lexing on demand. Empty otherwise. */
+  Lex         lexed;
+  /* Last lexed lexemes. Lexeme with an index is at the index modulo the window
+   * size. */
+  Lexeme      window[LEXEME_WINDOW];
+  /* Index of the current lexeme from the start of the file. */
+  size_t      index;
+  /* Amount of lexemes that were lexed. */
+  size_t      count;
+} LexemeStream;
+
 /* Initialize the module. */
-void        initLexer(void);
-/* Lex the given source file. */
-Lex         createLex(Source* lexed);
+void         initLexer(void);
+/* Lex the given source file. Large files are split into chunks that are lexed
+ * in parallel. Unknown characters are not reported. */
+Lex          createLex(Source* lexed);
 /* Release the memory used by the given lex. */
-void        disposeLex(Lex* disposed);
+void         disposeLex(Lex* disposed);
+/* Start lexing the given source file on demand. The first lexeme is current.
+ * Large files are lexed at once in parallel, and streamed after that. */
+LexemeStream createLexemeStream(Source* lexed);
+/* Stream the lexemes between the given indices of the given lex of the given
+ * source file. Last lexeme in the range ends the stream like the EOF. Lexemes
+ * are not copied; thus, the stream must not be disposed. */
+LexemeStream
+createLexRangeStream(Source* lexed, Lex streamed, size_t first, size_t after);
+/* Release the memory used by the given lexeme stream. */
+void        disposeLexemeStream(LexemeStream* disposed);
+/* Go to the lexeme after the current one. Returns whether there was one. */
+bool        nextLexeme(LexemeStream* advanced);
+/* Whether there is a lexeme after the current one. */
+bool        checkNextLexeme(LexemeStream* checked);
+/* Lexeme that the given stream is at. */
+Lexeme      getStreamCurrent(LexemeStream const* accessed);
+/* Lexeme before the one that the given stream is at, which must exist. */
+Lexeme      getStreamPrevious(LexemeStream const* accessed);
+/* Amount of lexemes in the given lex. */
+size_t      countLexemes(Lex counted);
+/* Variant of the lexeme at the given index of the given lex. */
+LexemeTag   getLexemeTag(Lex accessed, size_t index);
+/* Section of the lexeme at the given index of the given lex. */
+String      getLexemeSection(Lex accessed, size_t index);
+/* Lexeme at the given index of the given lex. */
+Lexeme      getLexeme(Lex accessed, size_t index);
 /* Name of the given lexeme variant. */
 char const* nameLexeme(LexemeTag named);
+/* Identifier of the given name. Identifiers are dense; they are given in the
+ * order the names are first interned, starting from zero. */
+uint32_t    internIdentifier(String interned);
+/* Name of the given identifier, which must be interned before. */
+String      nameIdentifier(uint32_t named);
@@ -0,0 +1,149 @@
+// SPDX-FileCopyrightText: 2022 Cem Geçgel <gecgelcem@outlook.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "lexer/api.h"
+#include "lexer/mod.h"
+#include "utility/api.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <threads.h>
+
+/* Interned name and its identifier. */
+typedef struct {
+  /* Copy of the name, which is empty if the slot is empty. */
+  String   name;
+  /* Identifier of the name. */
+  uint32_t identifier;
+} Interned;
+
+/* Amount of names in the first chunk of the interned names. Every chunk after
+ * it has twice the names of the one before. */
+#define FIRST_CHUNK_NAMES 1024
+/* Amount of chunks that is enough for all the 32-bit identifiers. */
+#define NAME_CHUNKS       23
+/* Amount of names that are remembered by every thread, which is a power of
+ * two. */
+#define FRONT_NAMES       1024
+
+/* Interned name that is remembered by a thread with its hashcode. */
+typedef struct {
+  /* Copy of the name, which is empty if the entry is empty. */
+  String   name;
+  /* Hashcode of the name. */
+  size_t   hash;
+  /* Identifier of the name. */
+  uint32_t identifier;
+} FrontName;
+
+/* Slots of the interned names, which are placed by their hashcodes. Names are
+ * copied, because the pool is shared by all the source files, and a source
+ * file might be released before the others are compiled. */
+static Interned* slots;
+/* Amount of slots, which is zero or a power of two. */
+static size_t    slotCount;
+/* Chunks of the interned names, which are indexed by their identifiers.
+ * Chunks are never moved; thus, names can be read without the lock. */
+static String*   chunks[NAME_CHUNKS];
+/* Amount of interned names. */
+static size_t    internedCount;
+/* Memory of the copies of the names, which live as long as the program. */
+static Arena     copies;
+/* Lock that makes sure only one source file interns a name at a time. */
+static mtx_t     identifiersLock;
+
+/* Names that were interned or found by the current thread, which are placed by
+ * their hashcodes. Names that are seen again are found here without taking
+ * the lock. Copies of the names are never moved; thus, they stay valid. */
+static _Thread_local FrontName front[FRONT_NAMES];
+
+void initIdentifiers() {
+  copies = createArena();
+  expect(
+    mtx_init(&identifiersLock, mtx_plain) == thrd_success,
+    "Could not create the identifiers lock!");
+}
+
+/* Slot that has the given name, or the empty slot the name would go into. A
+ * search ends at an empty slot, as the names are never removed. */
+static Interned* findSlot(String found, size_t hash) {
+  for (size_t index = hash;; index++) {
+    Interned* slot = slots + (index & (slotCount - 1));
+    if (
+      !countCharacters(slot->name) || compareStringEquality(slot->name, found))
+      return slot;
+  }
+}
+
+/* Double the amount of slots and place the interned names again. */
+static void growSlots() {
+  Interned* old      = slots;
+  size_t    oldCount = slotCount;
+  slotCount          = oldCount ? oldCount * 2 : 1024;
+  slots              = allocateArray(NULL, slotCount, Interned);
+  memset(slots, 0, slotCount * sizeof(Interned));
+  for (size_t index = 0; index < oldCount; index++)
+    if (countCharacters(old[index].name))
+      *findSlot(old[index].name, calculateHashcode(old[index].name)) =
+        old[index];
+  allocateArray(old, 0, Interned);
+}
+
+/* Index of the chunk that has the name of the given identifier. Sets the index
+ * of the name in the chunk to the given pointer. */
+static size_t findChunk(uint32_t found, size_t* index) {
+  // After shifting by the first chunk's size, a chunk starts at its size.
+  size_t shifted = (size_t)found + FIRST_CHUNK_NAMES;
+  size_t chunk   = 0;
+  while (shifted >= (size_t)FIRST_CHUNK_NAMES << (chunk + 1)) chunk++;
+  *index = shifted - ((size_t)FIRST_CHUNK_NAMES << chunk);
+  return chunk;
+}
+
+uint32_t internIdentifier(String interned) {
+  size_t     hash       = calculateHashcode(interned);
+  FrontName* remembered = front + (hash & (FRONT_NAMES - 1));
+  if (
+    remembered->hash == hash && countCharacters(remembered->name) &&
+    compareStringEquality(remembered->name, interned))
+    return remembered->identifier;
+  expect(mtx_lock(&identifiersLock) == thrd_success, "Could not lock!");
+
+  // Keep at least half of the slots empty so that searches end quickly.
+  if (2 * (internedCount + 1) > slotCount) growSlots();
+  Interned* slot = findSlot(interned, hash);
+  if (!countCharacters(slot->name)) {
+    expect(internedCount < UINT32_MAX, "Too many identifiers!");
+
+    // Copy the name to memory that lives as long as the pool.
+    size_t length = countCharacters(interned);
+    char*  copy   = allocateArenaArray(&copies, NULL, length, char);
+    memcpy(copy, interned.first, length);
+    *slot = (Interned){
+      .name       = createString(copy, copy + length),
+      .identifier = (uint32_t)internedCount};
+
+    // Add the name to the chunks, which might need a new one.
+    size_t index;
+    size_t chunk = findChunk(slot->identifier, &index);
+    if (!chunks[chunk])
+      chunks[chunk] =
+        allocateArray(NULL, (size_t)FIRST_CHUNK_NAMES << chunk, String);
+    chunks[chunk][index] = slot->name;
+    internedCount++;
+  }
+  *remembered = (FrontName){
+    .name = slot->name, .hash = hash, .identifier = slot->identifier};
+
+  expect(mtx_unlock(&identifiersLock) == thrd_success, "Could not unlock!");
+  return remembered->identifier;
+}
+
+String nameIdentifier(uint32_t named) {
+  // Identifier was interned by this thread, or given to it after it was
+  // interned; thus, its name was written before, and it is never moved.
+  size_t index;
+  size_t chunk = findChunk(named, &index);
+  return chunks[chunk][index];
+}
@@ -6,22 +6,140 @@
 #include "utility/api.h"
 
 #include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/* Chunks of a source file that are lexed separately. */
+typedef struct {
+  /* Lexed source. */
+  Source*      source;
+  /* Pointer to the start of the first chunk. Each chunk goes upto the start
+   * of the next one, and there is a start after the last chunk. */
+  char const** starts;
+  /* Pointer to the lex of the first chunk. */
+  Lex*         lexes;
+} Chunks;
+
+/* Lex the chunk at the given index. */
+static void lexChunk(void* chunks, size_t index) {
+  Chunks*      context = chunks;
+  Lex*         target  = context->lexes + index;
+  LexemeStream stream  = createRangeStream(
+     context->source, context->starts[index], context->starts[index + 1]);
+  while (lexNext(&stream))
+    pushLexeme(target, stream.window[(stream.count - 1) & (LEXEME_WINDOW - 1)]);
+}
 
 Lex createLex(Source* lexed) {
-  Lex result = {.first = NULL, .after = NULL, .bound = NULL};
-  lexSource(&result, lexed);
+  char const* first = lexed->contents.first;
+  char const* after = lexed->contents.after;
+  size_t      size  = after - first;
+
+  // Use a chunk for each processor, unless the chunks would be too small.
+  size_t count = countProcessors();
+  if (count > size / LEX_CHUNK_SIZE) count = size / LEX_CHUNK_SIZE;
+  if (!count) count = 1;
+
+  // Split the file evenly, but move the boundaries to after the next new line.
+  // No lexeme goes over a new line; comments end before it, and the new line
+  // is whitespace, which separates the unknown portions as well. Thus, the
+  // chunks can be lexed without knowing anything about each other, and there
+  // is nothing to join at the boundaries. As only the last chunk has the
+  // sentinel, there is only one EOF lexeme at the end.
+  Chunks chunks = {
+    .source = lexed,
+    .starts = allocateArray(NULL, count + 1, char const*),
+    .lexes  = allocateArray(NULL, count, Lex)};
+  chunks.starts[0] = first;
+  for (size_t index = 1; index < count; index++) {
+    char const* start    = first + size / count * index;
+    char const* previous = chunks.starts[index - 1];
+    if (start < previous) start = previous;
+    char const* newLine  = memchr(start, '\n', after - start);
+    chunks.starts[index] = newLine ? newLine + 1 : after;
+  }
+  chunks.starts[count] = after;
+  for (size_t index = 0; index < count; index++)
+    chunks.lexes[index] = (Lex){
+      .contents = first,
+      .tags     = NULL,
+      .starts   = NULL,
+      .lengths  = NULL,
+      .count    = 0,
+      .capacity = 0};
+  runTasks(&lexChunk, &chunks, count);
+
+  // Stitch the lexes of the chunks together in order.
+  size_t total = 0;
+  for (size_t index = 0; index < count; index++)
+    total += chunks.lexes[index].count;
+  Lex result = {
+    .contents = first,
+    .tags     = allocateArray(NULL, total, uint8_t),
+    .starts   = allocateArray(NULL, total, uint32_t),
+    .lengths  = allocateArray(NULL, total, uint32_t),
+    .count    = total,
+    .capacity = total};
+  size_t stitched = 0;
+  for (size_t index = 0; index < count; index++) {
+    Lex* chunk = chunks.lexes + index;
+    memcpy(result.tags + stitched, chunk->tags, chunk->count * sizeof(uint8_t));
+    memcpy(
+      result.starts + stitched, chunk->starts, chunk->count * sizeof(uint32_t));
+    memcpy(
+      result.lengths + stitched, chunk->lengths,
+      chunk->count * sizeof(uint32_t));
+    stitched += chunk->count;
+    disposeLex(chunk);
+  }
+
+  chunks.starts = allocateArray(chunks.starts, 0, char const*);
+  chunks.lexes  = allocateArray(chunks.lexes, 0, Lex);
   return result;
 }
 
 void disposeLex(Lex* disposed) {
-  disposed->first = allocateArray(disposed->first, 0, Lexeme);
-  disposed->after = disposed->first;
-  disposed->bound = disposed->after;
+  disposed->tags     = allocateArray(disposed->tags, 0, uint8_t);
+  disposed->starts   = allocateArray(disposed->starts, 0, uint32_t);
+  disposed->lengths  = allocateArray(disposed->lengths, 0, uint32_t);
+  disposed->count    = 0;
+  disposed->capacity = 0;
 }
 
-void pushLexeme(Lex* target, Lexeme pushed) {
-  reserveArray(target, 1, Lexeme);
-  *target->after++ = pushed;
+size_t countLexemes(Lex counted) { return counted.count; }
+
+LexemeTag getLexemeTag(Lex accessed, size_t index) {
+  return accessed.tags[index];
+}
+
+String getLexemeSection(Lex accessed, size_t index) {
+  char const* start = accessed.contents + accessed.starts[index];
+  return createString(start, start + accessed.lengths[index]);
+}
+
+Lexeme getLexeme(Lex accessed, size_t index) {
+  return (Lexeme){
+    .section = getLexemeSection(accessed, index),
+    .tag     = getLexemeTag(accessed, index)};
 }
 
-void popLexeme(Lex* target) { target->after--; }
+void pushLexeme(Lex* target, Lexeme pushed) {
+  // Grow all the arrays together by at least half of the current capacity.
+  if (target->count == target->capacity) {
+    target->capacity += max(1, target->capacity / 2);
+    target->tags   = allocateArray(target->tags, target->capacity, uint8_t);
+    target->starts = allocateArray(target->starts, target->capacity, uint32_t);
+    target->lengths =
+      allocateArray(target->lengths, target->capacity, uint32_t);
+  }
+
+  // Offsets are 32-bit; thus, lexemes must be in the first 4 GiB of the source.
+  size_t start = pushed.section.first - target->contents;
+  expect(
+    pushed.section.after - target->contents <= UINT32_MAX,
+    "Source file is too large to lex!");
+  target->tags[target->count]    = pushed.tag;
+  target->starts[target->count]  = start;
+  target->lengths[target->count] = countCharacters(pushed.section);
+  target->count++;
+}
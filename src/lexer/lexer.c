@@ -6,47 +6,59 @@
 #include "source/api.h"
 #include "utility/api.h"
 
+#include <limits.h>
 #include <stdbool.h>
 #include <stddef.h>
 
-/* Context of the lexing process. */
-typedef struct {
-  /* Lex to add the lexemes into. */
-  Lex*        lex;
-  /* Lexed source. */
-  Source*     source;
-  /* Position of the currently lexed character. */
-  char const* current;
-  /* Start of an unknown portion. Null if there is no unknown portion. */
-  char const* unknownStart;
-} Lexer;
+/* Class of a character, which decides the lexeme that starts with it. */
+typedef enum {
+  /* Character that cannot start any lexeme. */
+  CHARACTER_UNKNOWN,
+  /* Whitespace, which is skipped. */
+  CHARACTER_WHITESPACE,
+  /* Start of a mark. Some of them might start a comment or a decimal too. */
+  CHARACTER_MARK,
+  /* Start of a word. */
+  CHARACTER_WORD,
+  /* Decimal digit, which starts a decimal. */
+  CHARACTER_DIGIT,
+  /* Null-terminator, which is the end of file mark. */
+  CHARACTER_EOF
+} CharacterClass;
 
 String markNames[MARK_COUNT];
 String keywordNames[KEYWORD_COUNT];
 
+/* Indices of the marks ordered by their first characters, and longer marks
+ * before the shorter ones that start with the same character. */
+static size_t markOrder[MARK_COUNT];
+/* Position of the first mark in the order for each character. Marks that
+ * start with a character are upto the position of the next character. */
+static size_t markLeads[UCHAR_MAX + 2];
+
+/* Most amount of slots that could be used for finding keywords. */
+#define KEYWORD_SLOTS_LIMIT 1024
+/* Keyword index plus one at the slot of each keyword; zero at empty slots. */
+static size_t keywordSlots[KEYWORD_SLOTS_LIMIT];
+/* Amount of slots the keywords are placed into, which is a power of two. */
+static size_t keywordSlotCount;
+
+/* Class of each character. */
+static CharacterClass characterClasses[UCHAR_MAX + 1];
+
 /* Section of the source file starting from the given position upto the current
  * character. */
 #define createSection(startPosition) \
   createString(startPosition, context->current)
 
-/* Add a lexeme with the given value and type. If there was an error, reports
- * that first and clears the error start. */
-#define pushSectionAndTag(pushedSection, pushedTag)                          \
-  if (context->unknownStart) {                                               \
-    String unknown = createSection(context->unknownStart);                   \
-    highlightError(                                                          \
-      context->source, unknown, "Could not recognize %s!",                   \
-      countCharacters(unknown) > 1 ? "these characters" : "this character"); \
-    pushLexeme(                                                              \
-      context->lex, (Lexeme){.section = unknown, .tag = LEXEME_ERROR});      \
-    context->unknownStart = NULL;                                            \
-  }                                                                          \
-  pushLexeme(                                                                \
-    context->lex, (Lexeme){.section = (pushedSection), .tag = (pushedTag)})
+/* Add a lexeme with the given value and type to the window. */
+#define pushSectionAndTag(pushedSection, pushedTag)                    \
+  context->window[context->count++ & (LEXEME_WINDOW - 1)] = (Lexeme) { \
+    .section = (pushedSection), .tag = (pushedTag)                     \
+  }
 
 /* Whether there is a character to lex. */
-#define checkCharacterExistance() \
-  (context->current < context->source->contents.after)
+#define checkCharacterExistance() (context->current < context->after)
 
 /* Character that is lexed. */
 #define getCurrentCharacter() (*context->current)
@@ -62,16 +74,14 @@ String keywordNames[KEYWORD_COUNT];
 /* Go to the next character. */
 #define advanceOnce() (context->current++)
 
-/* Go to the previous character. */
-#define retreatOnce() (context->current--)
-
-/* Go back to the given position. */
-#define retreatToPosition(oldPosition) \
-  do { context->current = oldPosition; } while (false)
+/* Class of the given character. */
+static CharacterClass classifyCharacter(char classified) {
+  return characterClasses[(unsigned char)classified];
+}
 
 /* Whether the current character exists and it equals to the given one. Consumes
  * the character if true. */
-static bool takeOnce(Lexer* context, char taken) {
+static bool takeOnce(LexemeStream* context, char taken) {
   // Store the result; then, go to the next one.
   bool wasTaken = compareCurrent(taken);
   if (wasTaken) advanceOnce();
@@ -79,19 +89,16 @@ static bool takeOnce(Lexer* context, char taken) {
 }
 
 /* Whether the next characters are the same as the given string. Consumes the
- * characters if true. */
-static bool takeFixed(Lexer* context, String taken) {
-  char const* start = context->current;
-  size_t      count = countCharacters(taken);
+ * characters if true. Characters are only looked at, and consumed after all of
+ * them match; thus, nothing is read again after a mismatch. */
+static bool takeFixed(LexemeStream* context, String taken) {
+  size_t count = countCharacters(taken);
+  if ((size_t)(context->after - context->current) < count) return false;
 
   // Return `false` if any character is mismatched.
-  for (size_t character = 0; character < count; character++) {
-    if (!compareCurrent(taken.first[character])) {
-      retreatToPosition(start);
-      return false;
-    }
-    advanceOnce();
-  }
+  for (size_t character = 0; character < count; character++)
+    if (context->current[character] != taken.first[character]) return false;
+  context->current += count;
   return true;
 }
 
@@ -101,7 +108,7 @@ typedef bool (*Check)(char);
 /* Consume the characters if the first one fits the given leading check and
  * the remaining fit the given traling check. */
 static bool
-takeVarying(Lexer* context, Check takenLeading, Check takenTrailing) {
+takeVarying(LexemeStream* context, Check takenLeading, Check takenTrailing) {
   // Check the first character.
   if (!checkCurrent(takenLeading)) return false;
   advanceOnce();
@@ -122,57 +129,73 @@ static bool compareToDecimalDigit(char compared) {
   return compared >= '0' && compared <= '9';
 }
 
-/* Whether the given character is whitespace. */
+/* Whether the given character is whitespace. Carriage return is included
+ * because mapped source files do not go through new line translation. */
 static bool compareToWhitespace(char compared) {
-  return compared == ' ' || compared == '\t' || compared == '\n';
+  return compared == ' ' || compared == '\t' || compared == '\n' ||
+         compared == '\r';
 }
 
-/* Try to skip a whitespace. */
-static bool lexWhitespace(Lexer* context) {
-  return takeVarying(context, &compareToWhitespace, &compareToWhitespace);
+/* Whether the given character starts a lexeme that separates words and
+ * decimals, which are whitespace, comments and marks. */
+static bool compareToSeparatorLead(char compared) {
+  switch (classifyCharacter(compared)) {
+  case CHARACTER_WHITESPACE:
+  case CHARACTER_MARK:
+  case CHARACTER_EOF: return true;
+  default: return false;
+  }
 }
 
-/* Whether the given character is the start of a comment. */
-static bool compareToCommentLead(char compared) { return compared == '/'; }
+/* Whether the given character is not a separator lead. */
+static bool compareToUnseparated(char compared) {
+  return !compareToSeparatorLead(compared);
+}
 
-/* Whether the given character is the trailing characters of a comment. */
-static bool compareToCommentTrail(char compared) { return compared != '\n'; }
+/* Whether the current character is the end of a word or decimal. End of the
+ * contents separates as well, which is not there because of the sentinel. */
+static bool checkSeparation(LexemeStream* context) {
+  return !checkCharacterExistance() || checkCurrent(compareToSeparatorLead);
+}
 
-/* Try to skip a comment. */
-static bool lexComment(Lexer* context) {
-  // Handle the first slash manually, leave the second one to the helper.
-  if (!takeOnce(context, '/')) return false;
-  if (!takeVarying(context, &compareToCommentLead, &compareToCommentTrail)) {
-    retreatOnce(); // Roll back the first '/'.
-    return false;
-  }
+/* Lex the characters from the given start upto a separator as an unknown
+ * portion. They are reported when the lexeme is streamed. */
+static void lexUnknown(LexemeStream* context, char const* start) {
+  while (checkCurrent(compareToUnseparated)) advanceOnce();
+  pushSectionAndTag(createSection(start), LEXEME_ERROR);
+  context->joined = true;
+}
+
+/* Skip the whitespace. */
+static void lexWhitespace(LexemeStream* context) {
+  context->current = skipWhitespace(context->current, context->after);
+  context->joined  = false;
+}
+
+/* Try to skip a comment. Only looks at the character after a slash before
+ * consuming anything. */
+static bool lexComment(LexemeStream* context) {
+  if (getCurrentCharacter() != '/' || context->current[1] != '/') return false;
+  context->current = skipLine(context->current + 2, context->after);
   return true;
 }
 
-/* Try to lex a mark. */
-static bool lexMark(Lexer* context) {
+/* Lex a mark, which is guaranteed because all the mark leads are marks on their
+ * own. */
+static void lexMark(LexemeStream* context) {
   char const* start = context->current;
 
-  // Check whether there is a mark.
-  for (size_t mark = 0; mark < MARK_COUNT; mark++) {
+  // Only try the marks that start with the current character; the longest match
+  // is found first because of the order.
+  unsigned char lead = getCurrentCharacter();
+  for (size_t order = markLeads[lead]; order < markLeads[lead + 1]; order++) {
+    size_t mark = markOrder[order];
     if (takeFixed(context, markNames[mark])) {
       pushSectionAndTag(createSection(start), MARK_FIRST + mark);
-      return true;
+      return;
     }
   }
-
-  // EOF mark.
-  if (takeOnce(context, 0)) {
-    pushSectionAndTag(createSection(start), LEXEME_EOF);
-    return true;
-  }
-
-  return false;
-}
-
-/* Whether the given character can be start of a word. */
-static bool compareToWordLead(char compared) {
-  return compareToAlpha(compared) || compared == '_';
+  unexpected("Mark lead is not a mark!");
 }
 
 /* Whether the given character can be rest of a word. */
@@ -181,25 +204,38 @@ static bool compareToWordTrail(char compared) {
          compared == '_';
 }
 
-/* Try to lex a word. */
-static bool lexWord(Lexer* context) {
+/* Slot of the given word, which is guaranteed to be different for all the
+ * keywords. Any word can be hashed, as words are never empty. */
+static size_t slotKeyword(String hashed) {
+  size_t length = countCharacters(hashed);
+  return ((unsigned char)hashed.first[0] +
+          (unsigned char)hashed.first[length - 1] * 3 + length) &
+         (keywordSlotCount - 1);
+}
+
+/* Lex a word, which starts at the current character. */
+static void lexWord(LexemeStream* context) {
   char const* start = context->current;
 
   // Identifier.
-  if (!takeVarying(context, &compareToWordLead, &compareToWordTrail))
-    return false;
-  String word = createSection(start);
-
-  // Check whether it is a reserved identifier.
-  for (size_t keyword = 0; keyword < KEYWORD_COUNT; keyword++) {
-    if (compareStringEquality(word, keywordNames[keyword])) {
-      pushSectionAndTag(word, KEYWORD_FIRST + keyword);
-      return true;
-    }
+  advanceOnce();
+  while (checkCurrent(compareToWordTrail)) advanceOnce();
+  if (!checkSeparation(context)) {
+    lexUnknown(context, start);
+    return;
+  }
+  String word     = createSection(start);
+  context->joined = true;
+
+  // Check whether it is a reserved identifier. Only the keyword in the slot of
+  // the word could be equal to it.
+  size_t slot = keywordSlots[slotKeyword(word)];
+  if (slot && compareStringEquality(word, keywordNames[slot - 1])) {
+    pushSectionAndTag(word, KEYWORD_FIRST + slot - 1);
+    return;
   }
 
   pushSectionAndTag(word, LEXEME_IDENTIFIER);
-  return true;
 }
 
 /* Whether the given character can be start of a decimal. */
@@ -212,80 +248,229 @@ static bool compareToDecimalTrail(char compared) {
   return compareToDecimalDigit(compared) || compared == '_';
 }
 
-/* Try to lex a decimal literal. */
-static bool lexDecimal(Lexer* context) {
+/* Whether a decimal starts at the current character, which is a digit or a sign
+ * followed by a digit. Only looks at the character after a sign. */
+static bool checkDecimal(LexemeStream* context) {
+  char current = getCurrentCharacter();
+  if (current == '+' || current == '-')
+    return compareToDecimalLead(context->current[1]);
+  return compareToDecimalLead(current);
+}
+
+/* Lex a decimal literal, which starts at the current character. When a part of
+ * it is malformed, lexing continues as an unknown portion without going
+ * back. */
+static void lexDecimal(LexemeStream* context) {
   char const* start = context->current;
 
-  // Whole part.
-  // Optional sign.
+  // Whole part with an optional sign.
   takeOnce(context, '+') || takeOnce(context, '-');
-  if (!takeVarying(context, &compareToDecimalLead, &compareToDecimalTrail)) {
-    retreatToPosition(start);
-    return false;
-  }
+  bool complete =
+    takeVarying(context, &compareToDecimalLead, &compareToDecimalTrail);
 
-  // Fraction.
-  char const* fractionStart = context->current;
-  if (
-    takeOnce(context, '.') &&
-    !takeVarying(context, &compareToDecimalLead, &compareToDecimalTrail))
-    retreatToPosition(fractionStart);
-
-  // Exponent.
-  char const* exponentStart = context->current;
-  if (takeOnce(context, 'e') || takeOnce(context, 'E')) {
-    // Optional sign.
+  // Fraction, where the dot must be followed by digits.
+  if (complete && takeOnce(context, '.'))
+    complete =
+      takeVarying(context, &compareToDecimalLead, &compareToDecimalTrail);
+
+  // Exponent, which has an optional sign and must have digits.
+  if (complete && (takeOnce(context, 'e') || takeOnce(context, 'E'))) {
     takeOnce(context, '+') || takeOnce(context, '-');
-    if (!takeVarying(context, &compareToDecimalLead, &compareToDecimalTrail))
-      retreatToPosition(exponentStart);
+    complete =
+      takeVarying(context, &compareToDecimalLead, &compareToDecimalTrail);
   }
 
+  if (!complete || !checkSeparation(context)) {
+    lexUnknown(context, start);
+    return;
+  }
   pushSectionAndTag(createSection(start), LEXEME_DECIMAL);
-  return true;
+  context->joined = true;
 }
 
-/* Try to skip or lex a separator. */
-static bool lexSeparator(Lexer* context) {
-  return lexWhitespace(context) || lexComment(context) || lexMark(context);
+/* Lex a mark or a comment, or a signed decimal if the mark is not joined to
+ * the lexeme before it. */
+static void lexMarkLead(LexemeStream* context) {
+  if (!context->joined && checkDecimal(context)) {
+    lexDecimal(context);
+    return;
+  }
+  if (!lexComment(context)) lexMark(context);
+  context->joined = false;
 }
 
-/* Run the given lexer context. */
-static void lex(Lexer* context) {
-  while (checkCharacterExistance()) {
+/* Lex upto the end of the next lexeme. Every character is looked at once to
+ * decide the lexeme it starts, and the lexeme is lexed upto its end without
+ * going back. At most one character after the current one is looked at before
+ * consuming it. The sentinel after the contents, or the new line at the end of
+ * a range, makes sure that character exists. */
+bool lexNext(LexemeStream* context) {
+  size_t count = context->count;
+  while (context->count == count && checkCharacterExistance()) {
     char const* start = context->current;
-
-    if (lexWord(context) || lexDecimal(context)) {
-      if (lexSeparator(context)) continue;
-      // Roll back the word or decimal that was lexed because it is not
-      // separated from what comes after it.
-      retreatToPosition(start);
-      popLexeme(context->lex);
+    switch (classifyCharacter(getCurrentCharacter())) {
+    case CHARACTER_WHITESPACE: lexWhitespace(context); break;
+    case CHARACTER_MARK: lexMarkLead(context); break;
+    case CHARACTER_WORD: lexWord(context); break;
+    case CHARACTER_DIGIT: lexDecimal(context); break;
+    case CHARACTER_EOF:
+      advanceOnce();
+      pushSectionAndTag(createSection(start), LEXEME_EOF);
+      context->joined = false;
+      break;
+    case CHARACTER_UNKNOWN: lexUnknown(context, start); break;
+    default: unexpected("Unknown character class!");
     }
+  }
+  return context->count != count;
+}
 
-    if (lexSeparator(context)) continue;
+LexemeStream
+createRangeStream(Source* lexed, char const* first, char const* after) {
+  return (LexemeStream){
+    .source  = lexed,
+    .current = first,
+    .after   = after,
+    .joined  = false,
+    .lexed   = {.tags = NULL, .count = 0},
+    .index   = 0,
+    .count   = 0
+  };
+}
 
-    // Unknown character! Mark all characters until a separator is found.
-    context->unknownStart = start;
-    do { advanceOnce(); } while (!lexSeparator(context));
+/* Put the next lexeme to the window, either by lexing it or by taking it from
+ * the lex of the whole file. Interns the lexeme if it is an identifier, and
+ * reports it if it is unknown. Returns whether there was a lexeme. */
+static bool pullLexeme(LexemeStream* context) {
+  if (context->lexed.tags) {
+    if (context->count == countLexemes(context->lexed)) return false;
+    context->window[context->count & (LEXEME_WINDOW - 1)] =
+      getLexeme(context->lexed, context->count);
+    context->count++;
+  } else if (!lexNext(context)) {
+    return false;
   }
+
+  Lexeme* pulled =
+    context->window + ((context->count - 1) & (LEXEME_WINDOW - 1));
+  if (pulled->tag == LEXEME_IDENTIFIER)
+    pulled->identifier = internIdentifier(pulled->section);
+  if (pulled->tag == LEXEME_ERROR)
+    highlightError(
+      context->source, pulled->section, "Could not recognize %s!",
+      countCharacters(pulled->section) > 1 ? "these characters"
+                                           : "this character");
+  return true;
+}
+
+LexemeStream createLexemeStream(Source* lexed) {
+  LexemeStream created =
+    createRangeStream(lexed, lexed->contents.first, lexed->contents.after);
+
+  // Large files are lexed at once, which is done in parallel.
+  size_t size = lexed->contents.after - lexed->contents.first;
+  if (size >= LEX_AT_ONCE_SIZE) created.lexed = createLex(lexed);
+
+  // There is at least the lexeme of the null-terminator in the sentinel.
+  expect(pullLexeme(&created), "Source does not have an EOF!");
+  return created;
+}
+
+LexemeStream
+createLexRangeStream(Source* lexed, Lex streamed, size_t first, size_t after) {
+  expect(first < after && after <= countLexemes(streamed), "Invalid range!");
+  LexemeStream created = createRangeStream(lexed, NULL, NULL);
+
+  // View the range as a lex that starts at its first lexeme.
+  created.lexed = (Lex){
+    .contents = streamed.contents,
+    .tags     = streamed.tags + first,
+    .starts   = streamed.starts + first,
+    .lengths  = streamed.lengths + first,
+    .count    = after - first,
+    .capacity = after - first};
+
+  expect(pullLexeme(&created), "Range does not have a lexeme!");
+  return created;
 }
 
-void lexSource(Lex* target, Source* lexed) {
-  // Create a lexer and pass its pointer, because all the macros that are used
-  // require a lexer in the local scope. This makes the code easier to fallow
-  // by reducing function parameters without using a global context variable.
-  lex(&(Lexer){
-    .lex          = target,
-    .source       = lexed,
-    .current      = lexed->contents.first,
-    .unknownStart = NULL});
+void disposeLexemeStream(LexemeStream* disposed) {
+  if (disposed->lexed.tags) disposeLex(&disposed->lexed);
+}
+
+bool checkNextLexeme(LexemeStream* checked) {
+  // Only pull when the next lexeme is not in the window yet.
+  return checked->index + 1 < checked->count || pullLexeme(checked);
+}
+
+bool nextLexeme(LexemeStream* advanced) {
+  if (!checkNextLexeme(advanced)) return false;
+  advanced->index++;
+  return true;
+}
+
+Lexeme getStreamCurrent(LexemeStream const* accessed) {
+  return accessed->window[accessed->index & (LEXEME_WINDOW - 1)];
+}
+
+Lexeme getStreamPrevious(LexemeStream const* accessed) {
+  expect(accessed->index > 0, "There is not a previous lexeme!");
+  return accessed->window[(accessed->index - 1) & (LEXEME_WINDOW - 1)];
 }
 
 void initLexer() {
+  initIdentifiers();
+  initSkipping();
+
   // Cache lexeme tag names of lexemes that equal to a fixed pattern of
   // characters like marks and keywords.
   for (size_t i = 0; i < MARK_COUNT; i++)
     markNames[i] = viewTerminated(nameLexeme(MARK_FIRST + i));
   for (size_t i = 0; i < KEYWORD_COUNT; i++)
     keywordNames[i] = viewTerminated(nameLexeme(KEYWORD_FIRST + i));
+
+  // Find the least amount of slots where no keywords collide.
+  for (keywordSlotCount = 1;; keywordSlotCount *= 2) {
+    expect(
+      keywordSlotCount <= KEYWORD_SLOTS_LIMIT,
+      "Could not find distinct slots for the keywords!");
+    for (size_t i = 0; i < keywordSlotCount; i++) keywordSlots[i] = 0;
+    size_t keyword = 0;
+    for (; keyword < KEYWORD_COUNT; keyword++) {
+      size_t* slot = keywordSlots + slotKeyword(keywordNames[keyword]);
+      if (*slot) break;
+      *slot = keyword + 1;
+    }
+    if (keyword == KEYWORD_COUNT) break;
+  }
+
+  // Count the marks that start with each character; then, turn the counts to
+  // the positions after the marks of each character.
+  for (size_t i = 0; i < MARK_COUNT; i++)
+    markLeads[(unsigned char)*markNames[i].first + 1]++;
+  for (size_t i = 1; i < UCHAR_MAX + 2; i++) markLeads[i] += markLeads[i - 1];
+
+  // Place each mark after the longer marks of its character.
+  size_t placed[UCHAR_MAX + 1] = {0};
+  for (size_t i = 0; i < MARK_COUNT; i++) {
+    unsigned char lead  = *markNames[i].first;
+    size_t*       first = markOrder + markLeads[lead];
+    size_t*       order = first + placed[lead]++;
+    for (; order > first && countCharacters(markNames[order[-1]]) <
+                              countCharacters(markNames[i]);
+         order--)
+      *order = order[-1];
+    *order = i;
+  }
+
+  // Classify the characters by the lexemes they start.
+  for (size_t i = 0; i <= UCHAR_MAX; i++)
+    if (compareToWhitespace(i)) characterClasses[i] = CHARACTER_WHITESPACE;
+    else if (markLeads[i] < markLeads[i + 1])
+      characterClasses[i] = CHARACTER_MARK;
+    else if (compareToAlpha(i) || i == '_')
+      characterClasses[i] = CHARACTER_WORD;
+    else if (compareToDecimalDigit(i)) characterClasses[i] = CHARACTER_DIGIT;
+    else if (i == 0) characterClasses[i] = CHARACTER_EOF;
+    else characterClasses[i] = CHARACTER_UNKNOWN;
 }
@@ -7,6 +7,8 @@
 #include "source/api.h"
 #include "utility/api.h"
 
+#include <stdbool.h>
+
 /* First mark tag. */
 #define MARK_FIRST LEXEME_COMMA
 /* Tag after the last mark tag. */
@@ -25,9 +27,28 @@ extern String markNames[MARK_COUNT];
 /* Names of keyword lexeme variants. */
 extern String keywordNames[KEYWORD_COUNT];
 
+/* Amount of characters in a source file that makes it lexed at once instead
+ * of on demand. */
+#define LEX_AT_ONCE_SIZE (1 << 22)
+/* Least amount of characters in a chunk that is lexed by a thread. */
+#define LEX_CHUNK_SIZE   (1 << 20)
+
 /* Add the given lexeme to the end of the given lex. */
-void pushLexeme(Lex* target, Lexeme pushed);
-/* Remove the last lexeme from the given lex. */
-void popLexeme(Lex* target);
-/* Lex the given source file into the given lex. */
-void lexSource(Lex* target, Source* lexed);
+void        pushLexeme(Lex* target, Lexeme pushed);
+/* Create the pool of interned identifiers. */
+void        initIdentifiers(void);
+/* Choose the fastest way of skipping characters for the processor. */
+void        initSkipping(void);
+/* Position of the first character that is not whitespace in the given range,
+ * or the end of the range. */
+char const* skipWhitespace(char const* first, char const* after);
+/* Position of the first new line in the given range, or the end of the
+ * range. */
+char const* skipLine(char const* first, char const* after);
+/* Start lexing the given range of the given source file on demand. Range must
+ * end with a new line or the sentinel. Nothing is lexed yet. */
+LexemeStream
+     createRangeStream(Source* lexed, char const* first, char const* after);
+/* Lex the next lexeme of the given stream to its window without reporting.
+ * Returns whether there was a lexeme before the end of the range. */
+bool lexNext(LexemeStream* context);
@@ -0,0 +1,169 @@
+// SPDX-FileCopyrightText: 2022 Cem Geçgel <gecgelcem@outlook.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "lexer/mod.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+
+// Vectorized skipping is only implemented for x86-64, where SSE2 always exists
+// and AVX2 is checked at runtime.
+#if defined(__x86_64__) || defined(_M_X64)
+  #define SKIP_VECTORIZED
+  #include <immintrin.h>
+  #if defined(_MSC_VER)
+    #include <intrin.h>
+  #endif
+#endif
+
+/* Function that finds the first position in the given range where a run of
+ * skipped characters end. Returns the end of the range if all are skipped. */
+typedef char const* (*Skip)(char const* first, char const* after);
+
+/* Whether the given character is skipped as whitespace. */
+static bool checkWhitespace(char checked) {
+  return checked == ' ' || checked == '\t' || checked == '\n' ||
+         checked == '\r';
+}
+
+/* Skip whitespace one character at a time. */
+static char const* skipWhitespaceScalar(char const* first, char const* after) {
+  while (first < after && checkWhitespace(*first)) first++;
+  return first;
+}
+
+/* Skip until a new line one character at a time. */
+static char const* skipLineScalar(char const* first, char const* after) {
+  while (first < after && *first != '\n') first++;
+  return first;
+}
+
+#if defined(SKIP_VECTORIZED)
+
+  // AVX2 functions must be marked so that GCC and Clang generate them without
+  // enabling AVX2 for the whole program. MSVC does not need it.
+  #if defined(_MSC_VER) && !defined(__clang__)
+    #define TARGET_AVX2
+  #else
+    #define TARGET_AVX2 __attribute__((target("avx2")))
+  #endif
+
+/* Index of the lowest set bit in the given mask, which is not zero. */
+static unsigned findLowestBit(unsigned mask) {
+  #if defined(_MSC_VER) && !defined(__clang__)
+  unsigned long index;
+  _BitScanForward(&index, mask);
+  return index;
+  #else
+  return __builtin_ctz(mask);
+  #endif
+}
+
+/* Skip whitespace 16 characters at a time. */
+static char const* skipWhitespaceSSE2(char const* first, char const* after) {
+  __m128i const space          = _mm_set1_epi8(' ');
+  __m128i const tab            = _mm_set1_epi8('\t');
+  __m128i const newLine        = _mm_set1_epi8('\n');
+  __m128i const carriageReturn = _mm_set1_epi8('\r');
+  for (; after - first >= 16; first += 16) {
+    __m128i block = _mm_loadu_si128((__m128i const*)first);
+    __m128i found = _mm_or_si128(
+      _mm_or_si128(_mm_cmpeq_epi8(block, space), _mm_cmpeq_epi8(block, tab)),
+      _mm_or_si128(
+        _mm_cmpeq_epi8(block, newLine), _mm_cmpeq_epi8(block, carriageReturn)));
+    unsigned other = ~(unsigned)_mm_movemask_epi8(found) & 0xFFFF;
+    if (other) return first + findLowestBit(other);
+  }
+  return skipWhitespaceScalar(first, after);
+}
+
+/* Skip until a new line 16 characters at a time. */
+static char const* skipLineSSE2(char const* first, char const* after) {
+  __m128i const newLine = _mm_set1_epi8('\n');
+  for (; after - first >= 16; first += 16) {
+    __m128i  block = _mm_loadu_si128((__m128i const*)first);
+    unsigned found = _mm_movemask_epi8(_mm_cmpeq_epi8(block, newLine));
+    if (found) return first + findLowestBit(found);
+  }
+  return skipLineScalar(first, after);
+}
+
+/* Skip whitespace 32 characters at a time. */
+TARGET_AVX2 static char const*
+skipWhitespaceAVX2(char const* first, char const* after) {
+  __m256i const space          = _mm256_set1_epi8(' ');
+  __m256i const tab            = _mm256_set1_epi8('\t');
+  __m256i const newLine        = _mm256_set1_epi8('\n');
+  __m256i const carriageReturn = _mm256_set1_epi8('\r');
+  for (; after - first >= 32; first += 32) {
+    __m256i block = _mm256_loadu_si256((__m256i const*)first);
+    __m256i found = _mm256_or_si256(
+      _mm256_or_si256(
+        _mm256_cmpeq_epi8(block, space), _mm256_cmpeq_epi8(block, tab)),
+      _mm256_or_si256(
+        _mm256_cmpeq_epi8(block, newLine),
+        _mm256_cmpeq_epi8(block, carriageReturn)));
+    unsigned other = ~(unsigned)_mm256_movemask_epi8(found);
+    if (other) return first + findLowestBit(other);
+  }
+  return skipWhitespaceSSE2(first, after);
+}
+
+/* Skip until a new line 32 characters at a time. */
+TARGET_AVX2 static char const*
+skipLineAVX2(char const* first, char const* after) {
+  __m256i const newLine = _mm256_set1_epi8('\n');
+  for (; after - first >= 32; first += 32) {
+    __m256i  block = _mm256_loadu_si256((__m256i const*)first);
+    unsigned found = _mm256_movemask_epi8(_mm256_cmpeq_epi8(block, newLine));
+    if (found) return first + findLowestBit(found);
+  }
+  return skipLineSSE2(first, after);
+}
+
+/* Whether the processor and the operating system support AVX2. */
+static bool checkAVX2(void) {
+  #if defined(_MSC_VER) && !defined(__clang__)
+  // AVX2 is the 5th bit of EBX in the 7th leaf. The operating system must
+  // save the YMM registers as well, which is shown by the OSXSAVE bit in the
+  // 1st leaf and the extended control register.
+  int registers[4];
+  __cpuid(registers, 0);
+  if (registers[0] < 7) return false;
+  __cpuid(registers, 1);
+  if (!(registers[2] & (1 << 27))) return false;
+  if ((_xgetbv(0) & 6) != 6) return false;
+  __cpuidex(registers, 7, 0);
+  return registers[1] & (1 << 5);
+  #else
+  __builtin_cpu_init();
+  return __builtin_cpu_supports("avx2");
+  #endif
+}
+
+#endif
+
+/* Whitespace skipper that is chosen for the processor. */
+static Skip whitespaceSkipper = &skipWhitespaceScalar;
+/* New line finder that is chosen for the processor. */
+static Skip lineSkipper       = &skipLineScalar;
+
+void initSkipping() {
+#if defined(SKIP_VECTORIZED)
+  if (checkAVX2()) {
+    whitespaceSkipper = &skipWhitespaceAVX2;
+    lineSkipper       = &skipLineAVX2;
+  } else {
+    whitespaceSkipper = &skipWhitespaceSSE2;
+    lineSkipper       = &skipLineSSE2;
+  }
+#endif
+}
+
+char const* skipWhitespace(char const* first, char const* after) {
+  return whitespaceSkipper(first, after);
+}
+
+char const* skipLine(char const* first, char const* after) {
+  return lineSkipper(first, after);
+}
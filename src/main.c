@@ -8,39 +8,177 @@
 #include "source/api.h"
 #include "utility/api.h"
 
+#include <stdbool.h>
+#include <stddef.h>
 #include <stdio.h>
+#include <string.h>
+#include <time.h>
 
-/* Start the program. */
-int main(int const argumentCount, char const* const* const arguments) {
-  // Check input arguments.
-  if (argumentCount != 2) {
-    fprintf(
-      stderr, "Provide %s Thrice file!\n",
-      argumentCount > 2 ? "only one" : "a");
-    return -1;
+/* Compilation of a Thrice file. */
+typedef struct {
+  /* Name of the compiled file. */
+  char const* name;
+  /* Amount of errors orginated in the compiled file. */
+  int         errors;
+  /* Amount of warnings orginated in the compiled file. */
+  int         warnings;
+} Compilation;
+
+/* Compilations of all the Thrice files that are given to the program. */
+typedef struct {
+  /* Pointer to the first compilation. */
+  Compilation* first;
+  /* Pointer to one after the last compilation. */
+  Compilation* after;
+  /* Whether the statistics of the compilations are reported. */
+  bool         verbose;
+  /* Whether the parses are mapped from and written to the caches next to the
+   * compiled files. */
+  bool         cached;
+  /* Local date and time the compilations started, which is found once,
+   * because `localtime` is not safe to call from parallel compilations. */
+  struct tm    started;
+} Compilations;
+
+/* Generate the given table of the given source file at the given local date
+ * and time. When the file is compiled alone, it is generated to `build.c`;
+ * otherwise, to a C file with the same name as the source file. */
+static void
+generate(Source* generated, Table table, bool alone, struct tm dateTime) {
+  if (alone) {
+    generateTable(table, "build.c", dateTime);
+    return;
   }
 
-  initLexer();
+  // Join the name with the extension.
+  Buffer path = createBuffer(strlen(generated->name) + 3);
+  appendString(&path, viewTerminated(generated->name));
+  appendString(&path, viewTerminated(".c"));
+  appendCharacter(&path, 0);
+  generateTable(table, path.first, dateTime);
+  disposeBuffer(&path);
+}
 
-  Source source = createSource(arguments[1]);
-  Lex    lex    = createLex(&source);
-  Parse  parse  = createParse(&source, lex);
-  Table  table  = createTable(&source, parse);
+/* Parse of the given source file. If caching is enabled, parse is mapped from
+ * the cache if the file did not change since it was cached; otherwise, the
+ * file is lexed, parsed and cached. */
+static Parse parseSource(Source* parsed, bool cached) {
+  Parse mapped;
+  if (cached && mapParse(&mapped, parsed)) return mapped;
 
-  if (source.warnings > 0)
+  LexemeStream lexemes = createLexemeStream(parsed);
+  Parse        created = createParse(parsed, lexemes);
+  disposeLexemeStream(&lexemes);
+
+  // Parses with errors are not cached, because their errors would not be
+  // reported when they are mapped.
+  if (cached && !parsed->errors) writeParse(created, parsed);
+  return created;
+}
+
+/* Compile the Thrice file at the given index of the given compilations. Every
+ * compilation has its own source, lexemes, parse and table; thus, they can run
+ * in parallel. */
+static void compile(void* compilations, size_t index) {
+  Compilations* context  = compilations;
+  Compilation*  compiled = context->first + index;
+  bool          alone    = context->after - context->first == 1;
+
+  Source source = createSource(compiled->name);
+  Parse  parse  = parseSource(&source, context->cached);
+  Table  table  = createTable(&source, parse, context->verbose);
+
+  // Summary is aggregated for all the files, unless the file is alone.
+  if (alone && source.warnings > 0)
     reportInfo(
       &source,
       source.warnings > 1 ? "There were %u warnings." : "There was a warning.",
       source.warnings);
-  if (source.errors > 0)
+  if (alone && source.errors > 0)
     reportInfo(
       &source,
       source.errors > 1 ? "There were %u errors." : "There was an error.",
       source.errors);
-  else generateTable(table);
+  if (!source.errors) generate(&source, table, alone, context->started);
+
+  compiled->errors   = source.errors;
+  compiled->warnings = source.warnings;
 
   disposeTable(&table);
   disposeParse(&parse);
-  disposeLex(&lex);
   disposeSource(&source);
 }
+
+/* Print the given total amount of reports, which originated in the given
+ * amount of files out of the given total amount of files. */
+static void summarize(
+  char const* singular, char const* plural, int total, size_t files,
+  size_t totalFiles) {
+  if (total == 1)
+    printf("info: There was %s in one of %zu files.\n", singular, totalFiles);
+  else if (total > 1)
+    printf(
+      "info: There were %i %s in %zu of %zu files.\n", total, plural, files,
+      totalFiles);
+}
+
+/* Start the program. */
+int main(int const argumentCount, char const* const* const arguments) {
+  // Separate the options from the compiled files.
+  Compilations compilations;
+  compilations.first   = allocateArray(NULL, argumentCount, Compilation);
+  compilations.after   = compilations.first;
+  compilations.verbose = false;
+  compilations.cached  = false;
+  for (int index = 1; index < argumentCount; index++) {
+    if (!strcmp(arguments[index], "--verbose")) {
+      compilations.verbose = true;
+      continue;
+    }
+    if (!strcmp(arguments[index], "--cache")) {
+      compilations.cached = true;
+      continue;
+    }
+    *compilations.after++ =
+      (Compilation){.name = arguments[index], .errors = 0, .warnings = 0};
+  }
+
+  // Check input arguments.
+  size_t count = compilations.after - compilations.first;
+  if (!count) {
+    fprintf(stderr, "Provide a Thrice file!\n");
+    compilations.first = allocateArray(compilations.first, 0, Compilation);
+    return -1;
+  }
+
+  initLexer();
+  initParser();
+  initSource();
+  initAnalyzer();
+
+  // Stamp all the generated files with the same date and time.
+  time_t now           = time(NULL);
+  compilations.started = *localtime(&now);
+
+  // Compile all the files on the available processors.
+  runTasks(&compile, &compilations, count);
+
+  // Aggregate the summaries of the files.
+  if (count > 1) {
+    int    errors         = 0;
+    int    warnings       = 0;
+    size_t erroneousFiles = 0;
+    size_t warnedFiles    = 0;
+    for (Compilation const* compiled = compilations.first;
+         compiled < compilations.after; compiled++) {
+      errors += compiled->errors;
+      warnings += compiled->warnings;
+      erroneousFiles += compiled->errors > 0;
+      warnedFiles += compiled->warnings > 0;
+    }
+    summarize("a warning", "warnings", warnings, warnedFiles, count);
+    summarize("an error", "errors", errors, erroneousFiles, count);
+  }
+
+  compilations.first = allocateArray(compilations.first, 0, Compilation);
+}
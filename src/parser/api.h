@@ -9,6 +9,7 @@
 
 #include <stdbool.h>
 #include <stddef.h>
+#include <stdint.h>
 
 /* Operators without operands. */
 typedef struct {
@@ -239,6 +240,8 @@ bool     compareOperatorEquality(Operator left, Operator right);
 /* Amount of operators in the given precedence and given index in the precedence
  * level. */
 size_t   countInLevelOperators(OperatorPrecedence counted);
+/* Whether there is an operator with the given hash. */
+bool     checkOperator(size_t checkedHash);
 /* Operator with the given hash. */
 Operator getOperator(size_t gottenHash);
 /* Operator at the given prececence and index. */
@@ -247,18 +250,37 @@ getOperatorAt(OperatorPrecedence gottenPrecedence, size_t gottenInLevelIndex);
 /* Name of the given operator. */
 char const* nameOperator(Operator named);
 
-/* Instantiation of an operator. */
+/* Most amount of operands an expression node can have. */
+#define NODE_ARITY_LIMIT ((1 << 24) - 1)
+
+/* Instantiation of an operator. Packed into 16 bytes by keeping the section as
+ * an offset and a length from the start of the source contents. */
 typedef struct {
+  /* Offset of the combined source section of all the lexemes of the expression
+   * from the start of the source contents. */
+  uint32_t start;
+  /* Amount of characters in the section. */
+  uint32_t length;
+  /* Interned identifier of the accessed symbol if the operator is a symbol
+   * access. */
+  uint32_t identifier;
   /* Hash of the instantiated operator. */
-  size_t operator;
+  uint32_t operator:8;
   /* Amount of operands, which are the nodes that come before this one in the
    * expression's array. */
-  size_t arity;
-  /* Combined source section of all the lexemes of the expression. */
-  String section;
+  uint32_t arity   :24;
 } ExpressionNode;
 
-/* Operations that result in calculation of a value. */
+/* Operations that result in calculation of a value. Nodes are in the node pool
+ * of the parse that has the expression. */
+typedef struct {
+  /* Index of the first node in the pool. */
+  size_t offset;
+  /* Amount of nodes. */
+  size_t count;
+} Expression;
+
+/* Nodes of all the expressions in a parse, which are allocated together. */
 typedef struct {
   /* Pointer to the first node if it exists. */
   ExpressionNode* first;
@@ -266,17 +288,17 @@ typedef struct {
   ExpressionNode* after;
   /* Pointer to one after the last allocated node. */
   ExpressionNode* bound;
-} Expression;
+} NodePool;
 
 /* Amount of nodes in the given expression. */
 size_t countExpressionNodes(Expression counted);
-/* Section of the source file that has the given expression. */
-String getExpressionSection(Expression gotten);
 
 /* Creation of an immutable binding with its type and value. */
 typedef struct {
   /* Identifier of the defined binding. */
   String     name;
+  /* Interned identifier of the name of the defined binding. */
+  uint32_t   identifier;
   /* Expression that gives the type of the defined binding. */
   Expression type;
   /* Expression that gives the value of the defined binding. */
@@ -288,6 +310,8 @@ typedef struct {
 typedef struct {
   /* Identifier of the defined binding. */
   String     name;
+  /* Interned identifier of the name of the defined binding. */
+  uint32_t   identifier;
   /* Expression that gives the value of the defined binding. */
   Expression value;
 } InferredBindingDefinition;
@@ -296,6 +320,8 @@ typedef struct {
 typedef struct {
   /* Identifier of the defined variable. */
   String     name;
+  /* Interned identifier of the name of the defined variable. */
+  uint32_t   identifier;
   /* Expression that gives the type of the defined variable. */
   Expression type;
   /* Expression that gives the initial value of the defined variable. */
@@ -307,6 +333,8 @@ typedef struct {
 typedef struct {
   /* Identifier of the defined variable. */
   String     name;
+  /* Interned identifier of the name of the defined variable. */
+  uint32_t   identifier;
   /* Expression that gives the initial value of the defined variable. */
   Expression initialValue;
 } InferredVariableDefinition;
@@ -316,6 +344,8 @@ typedef struct {
 typedef struct {
   /* Identifier of the defined variable. */
   String     name;
+  /* Interned identifier of the name of the defined variable. */
+  uint32_t   identifier;
   /* Expression that gives the type of the defined variable. */
   Expression type;
 } DefaultedVariableDefinition;
@@ -367,14 +397,40 @@ typedef struct {
 /* Result of parsing a lex. */
 typedef struct {
   /* Pointer to the first statement if it exists. */
-  Statement* first;
+  Statement*  first;
   /* Pointer to one after the last statement. */
-  Statement* after;
+  Statement*  after;
   /* Pointer to one after the last allocated statement. */
-  Statement* bound;
+  Statement*  bound;
+  /* Nodes of the expressions in the statements. */
+  NodePool    nodes;
+  /* Start of the contents of the parsed source, which sections of the nodes
+   * start from. */
+  char const* contents;
 } Parse;
 
-/* Parse the given lex. Reports to the given outcome. */
-Parse createParse(Source* reported, Lex parsed);
+/* Section of the source file that has the given node of the given parse. */
+String getNodeSection(Parse source, ExpressionNode gotten);
+
+/* Last node of the given expression in the given parse, which is the root of
+ * the expression. */
+ExpressionNode const* getExpressionRoot(Parse source, Expression gotten);
+/* Section of the source file that has the given expression in the given
+ * parse. */
+String                getExpressionSection(Parse source, Expression gotten);
+
+/* Initialize the module. */
+void  initParser(void);
+/* Parse the given lexemes, which are lexed as they are parsed. Reports to the
+ * given outcome. */
+Parse createParse(Source* reported, LexemeStream parsed);
 /* Release the memory resources used by the given parse. */
 void  disposeParse(Parse* disposed);
+/* Write the given parse of the given source file to the cache of the source
+ * file. Cache is kept next to the source file with the `.trp` extension, and
+ * is keyed by the hashcode of the source contents and the compiler build. */
+void  writeParse(Parse written, Source const* parsed);
+/* Load the parse of the given source file from its cache to the given parse
+ * without lexing or parsing the file. Returns whether there was a valid cache
+ * that was written from the same contents. */
+bool  mapParse(Parse* target, Source const* parsed);
@@ -0,0 +1,374 @@
+// SPDX-FileCopyrightText: 2022 Cem Geçgel <gecgelcem@outlook.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "lexer/api.h"
+#include "parser/api.h"
+#include "parser/mod.h"
+#include "source/api.h"
+#include "utility/api.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+/* Version of the cache format. Must change with the layout of the cached
+ * statements and nodes, or with the operator hashes. */
+#define CACHE_VERSION 2
+
+/* Identity of the compiler build that writes the caches. Caches written by
+ * another build are parsed again, because its parser could differ. Build
+ * recompiles this file whenever the lexer or the parser changes. */
+#define CACHE_BUILD __DATE__ " " __TIME__
+
+/* Start of a cached parse, which is followed by the statements and the
+ * nodes. */
+typedef struct {
+  /* Characters that mark the file as a cached parse. */
+  char     magic[4];
+  /* Version of the format. */
+  uint32_t version;
+  /* Size of a cached statement, which guards against a different layout. */
+  uint32_t statementSize;
+  /* Size of an expression node, which guards against a different layout. */
+  uint32_t nodeSize;
+  /* Hashcode of the identity of the compiler build that wrote the cache. */
+  uint64_t build;
+  /* Hashcode of the contents of the parsed source file, which is the key of
+   * the cache. */
+  uint64_t hash;
+  /* Amount of characters in the contents of the parsed source file. */
+  uint64_t size;
+  /* Amount of cached statements. */
+  uint64_t statements;
+  /* Amount of cached nodes. */
+  uint64_t nodes;
+  /* Hashcode of the statements and the nodes, which guards against a
+   * corrupted or truncated cache. */
+  uint64_t checksum;
+} CacheHeader;
+
+/* Expression with a fixed size. */
+typedef struct {
+  /* Index of the first node in the pool. */
+  uint64_t offset;
+  /* Amount of nodes. */
+  uint64_t count;
+} CachedExpression;
+
+/* Statement without any pointers, whose name is kept as an offset from the
+ * start of the source contents. Identifiers are not kept, because they differ
+ * between runs; they are interned again when the statement is mapped. */
+typedef struct {
+  /* Variant of the statement. */
+  uint32_t         tag;
+  /* Offset of the name of the defined symbol if the statement is a
+   * definition. */
+  uint32_t         nameStart;
+  /* Amount of characters in the name. */
+  uint32_t         nameLength;
+  /* Unused space, which is zero. */
+  uint32_t         padding;
+  /* Expressions in the order they are written in the statement. Ones that do
+   * not exist in the statement are empty. */
+  CachedExpression expressions[2];
+} CachedStatement;
+
+/* Path of the cache of the given source file. */
+static Buffer createCachePath(Source const* cached) {
+  // Join the name with the extension.
+  Buffer path = createBuffer(strlen(cached->name) + 5);
+  appendString(&path, viewTerminated(cached->name));
+  appendString(&path, viewTerminated(".trp"));
+  appendCharacter(&path, 0);
+  return path;
+}
+
+/* Header of a cache of the given source file with the given amount of
+ * statements and nodes, and the given checksum. */
+static CacheHeader createCacheHeader(
+  Source const* cached, size_t statements, size_t nodes, size_t checksum) {
+  return (CacheHeader){
+    .magic         = {'T', 'R', 'P', 0},
+    .version       = CACHE_VERSION,
+    .statementSize = sizeof(CachedStatement),
+    .nodeSize      = sizeof(ExpressionNode),
+    .build         = calculateHashcode(viewTerminated(CACHE_BUILD)),
+    .hash          = calculateHashcode(
+               createString(cached->contents.first, cached->contents.after)),
+    .size       = countBytes(cached->contents),
+    .statements = statements,
+    .nodes      = nodes,
+    .checksum   = checksum
+  };
+}
+
+/* Given expression with a fixed size. */
+static CachedExpression cacheExpression(Expression cached) {
+  return (CachedExpression){.offset = cached.offset, .count = cached.count};
+}
+
+/* Cached statement with the given variant, name and expressions from the given
+ * parse. */
+static CachedStatement createCachedStatement(
+  Parse cached, StatementTag tag, String name, Expression first,
+  Expression second) {
+  return (CachedStatement){
+    .tag         = tag,
+    .nameStart   = name.first ? (uint32_t)(name.first - cached.contents) : 0,
+    .nameLength  = (uint32_t)countCharacters(name),
+    .padding     = 0,
+    .expressions = {cacheExpression(first), cacheExpression(second)}
+  };
+}
+
+/* Given statement of the given parse without any pointers. */
+static CachedStatement cacheStatement(Parse cached, Statement statement) {
+  Expression empty = {.offset = 0, .count = 0};
+  switch (statement.tag) {
+  case STATEMENT_BINDING_DEFINITION:
+    return createCachedStatement(
+      cached, statement.tag, statement.asBindingDefinition.name,
+      statement.asBindingDefinition.type, statement.asBindingDefinition.value);
+  case STATEMENT_INFERRED_BINDING_DEFINITION:
+    return createCachedStatement(
+      cached, statement.tag, statement.asInferredBindingDefinition.name,
+      statement.asInferredBindingDefinition.value, empty);
+  case STATEMENT_VARIABLE_DEFINITION:
+    return createCachedStatement(
+      cached, statement.tag, statement.asVariableDefinition.name,
+      statement.asVariableDefinition.type,
+      statement.asVariableDefinition.initialValue);
+  case STATEMENT_INFERRED_VARIABLE_DEFINITION:
+    return createCachedStatement(
+      cached, statement.tag, statement.asInferredVariableDefinition.name,
+      statement.asInferredVariableDefinition.initialValue, empty);
+  case STATEMENT_DEFAULTED_VARIABLE_DEFINITION:
+    return createCachedStatement(
+      cached, statement.tag, statement.asDefaultedVariableDefinition.name,
+      statement.asDefaultedVariableDefinition.type, empty);
+  case STATEMENT_DISCARDED_EXPRESSION:
+    return createCachedStatement(
+      cached, statement.tag, EMPTY_STRING,
+      statement.asDiscardedExpression.discarded, empty);
+  default: unexpected("Unknown statement variant!");
+  }
+}
+
+void writeParse(Parse written, Source const* parsed) {
+  Buffer path   = createCachePath(parsed);
+  FILE*  target = fopen(path.first, "wb");
+  disposeBuffer(&path);
+
+  // Cache is only an optimization; thus, the compilation goes on without it if
+  // it cannot be written. A partially written cache is not mapped, because
+  // its size and checksum do not match its header.
+  if (!target) return;
+
+  // Gather the statements and the nodes first, because the header has their
+  // checksum.
+  size_t nodes      = countPooledNodes(written);
+  size_t statements = written.after - written.first;
+  Buffer body       = createBuffer(
+          statements * sizeof(CachedStatement) + nodes * sizeof(ExpressionNode));
+  for (Statement const* statement = written.first; statement < written.after;
+       statement++) {
+    CachedStatement cached = cacheStatement(written, *statement);
+    appendString(
+      &body, createString((char const*)&cached, (char const*)(&cached + 1)));
+  }
+  appendString(
+    &body,
+    createString(
+      (char const*)written.nodes.first, (char const*)written.nodes.after));
+
+  CacheHeader header = createCacheHeader(
+    parsed, statements, nodes,
+    calculateHashcode(createString(body.first, body.after)));
+  fwrite(&header, sizeof(CacheHeader), 1, target);
+  fwrite(body.first, 1, countBytes(body), target);
+  fclose(target);
+  disposeBuffer(&body);
+}
+
+/* Whether the given section is in the contents of the given size. */
+static bool checkSection(uint64_t size, uint64_t start, uint64_t length) {
+  return start <= size && length <= size - start;
+}
+
+/* Whether the given node has a section in the contents of the given size with
+ * at least a lexeme, and has a known operator with an arity that suits the
+ * operator. */
+static bool checkNode(ExpressionNode checked, uint64_t size) {
+  if (
+    !checked.length || !checkSection(size, checked.start, checked.length) ||
+    !checkOperator(checked.operator))
+    return false;
+  switch (getOperator(checked.operator).tag) {
+  case OPERATOR_NULLARY: return checked.arity == 0;
+  case OPERATOR_PRENARY:
+  case OPERATOR_POSTARY:
+  case OPERATOR_CIRNARY: return checked.arity == 1;
+  case OPERATOR_BINARY: return checked.arity == 2;
+  case OPERATOR_VARIARY: return checked.arity >= 1;
+  default: return false;
+  }
+}
+
+/* Whether the given expression is in the node pool of the given parse, and its
+ * nodes form a single tree. Operands of a node are the trees that come right
+ * before it; thus, a node cannot have more operands than the trees before it,
+ * and the expression must end with exactly one tree. */
+static bool checkExpression(Parse checked, CachedExpression expression) {
+  size_t nodes = countPooledNodes(checked);
+  if (expression.offset > nodes || expression.count > nodes - expression.offset)
+    return false;
+
+  size_t                trees = 0;
+  ExpressionNode const* first = checked.nodes.first + expression.offset;
+  for (ExpressionNode const* node = first; node < first + expression.count;
+       node++) {
+    if (node->arity > trees) return false;
+    trees = trees - node->arity + 1;
+  }
+  return trees == 1;
+}
+
+/* Expression that is restored from the given cached expression. */
+static Expression restoreExpression(CachedExpression restored) {
+  return (Expression){.offset = restored.offset, .count = restored.count};
+}
+
+/* Add the given cached statement to the given parse of the source file with
+ * the given size. Returns whether the statement was valid. */
+static bool
+restoreStatement(Parse* target, uint64_t size, CachedStatement restored) {
+  // Only the definitions with a type and a value have the second expression,
+  // and all the statements other than the discarded expression have a name.
+  bool paired = restored.tag == STATEMENT_BINDING_DEFINITION ||
+                restored.tag == STATEMENT_VARIABLE_DEFINITION;
+  bool named = restored.tag != STATEMENT_DISCARDED_EXPRESSION;
+  if (
+    named != (restored.nameLength > 0) ||
+    !checkSection(size, restored.nameStart, restored.nameLength) ||
+    !checkExpression(*target, restored.expressions[0]) ||
+    (paired ? !checkExpression(*target, restored.expressions[1])
+            : restored.expressions[1].count))
+    return false;
+
+  // Intern the name again, as if it was lexed.
+  char const* start = target->contents + restored.nameStart;
+  Lexeme      name  = {
+          .section    = createString(start, start + restored.nameLength),
+          .tag        = LEXEME_IDENTIFIER,
+          .identifier = 0};
+  if (named) name.identifier = internIdentifier(name.section);
+  Expression first  = restoreExpression(restored.expressions[0]);
+  Expression second = restoreExpression(restored.expressions[1]);
+
+  switch (restored.tag) {
+  case STATEMENT_BINDING_DEFINITION:
+    pushBindingDefinition(target, name, first, second);
+    return true;
+  case STATEMENT_INFERRED_BINDING_DEFINITION:
+    pushInferredBindingDefinition(target, name, first);
+    return true;
+  case STATEMENT_VARIABLE_DEFINITION:
+    pushVariableDefinition(target, name, first, second);
+    return true;
+  case STATEMENT_INFERRED_VARIABLE_DEFINITION:
+    pushInferredVariableDefinition(target, name, first);
+    return true;
+  case STATEMENT_DEFAULTED_VARIABLE_DEFINITION:
+    pushDefaultedVariableDefinition(target, name, first);
+    return true;
+  case STATEMENT_DISCARDED_EXPRESSION:
+    pushDiscardedExpression(target, first);
+    return true;
+  default: return false;
+  }
+}
+
+/* Add the given cached nodes to the node pool of the given parse of the source
+ * file with the given size. Returns whether all the nodes were valid. */
+static bool restoreNodes(
+  Parse* target, uint64_t size, ExpressionNode const* restored,
+  size_t restoredCount) {
+  reserveArray(&target->nodes, restoredCount, ExpressionNode);
+  if (restoredCount)
+    memcpy(
+      target->nodes.after, restored, restoredCount * sizeof(ExpressionNode));
+  target->nodes.after += restoredCount;
+
+  // Intern the names of the accessed symbols again, as if they were lexed.
+  for (ExpressionNode* node = target->nodes.first; node < target->nodes.after;
+       node++) {
+    if (!checkNode(*node, size)) return false;
+    if (node->operator== SYMBOL_ACCESS)
+      node->identifier = internIdentifier(getNodeSection(*target, *node));
+  }
+  return true;
+}
+
+/* Restore the given contents of a cache of the given source file to the given
+ * parse. Returns whether the cache was valid and made from the same contents
+ * as the source file. */
+static bool restoreParse(Parse* target, Source const* parsed, Buffer restored) {
+  // Check the header, and that the cache has exactly the space for the
+  // statements and nodes in the header.
+  size_t      size = countBytes(restored) - SENTINEL_SIZE;
+  CacheHeader header;
+  if (size < sizeof(CacheHeader)) return false;
+  memcpy(&header, restored.first, sizeof(CacheHeader));
+  CacheHeader expected =
+    createCacheHeader(parsed, header.statements, header.nodes, header.checksum);
+  if (memcmp(&header, &expected, sizeof(CacheHeader))) return false;
+  size_t remaining = size - sizeof(CacheHeader);
+  if (header.statements > remaining / sizeof(CachedStatement)) return false;
+  remaining -= header.statements * sizeof(CachedStatement);
+  if (header.nodes != remaining / sizeof(ExpressionNode)) return false;
+  if (remaining % sizeof(ExpressionNode)) return false;
+
+  // Check the statements and the nodes against the checksum before trusting
+  // their structure.
+  String body =
+    createString(restored.first + sizeof(CacheHeader), restored.first + size);
+  if (calculateHashcode(body) != header.checksum) return false;
+
+  // Statements come after the header, and nodes come after the statements.
+  CachedStatement const* statements =
+    (CachedStatement const*)(restored.first + sizeof(CacheHeader));
+  ExpressionNode const* nodes =
+    (ExpressionNode const*)(statements + header.statements);
+  if (!restoreNodes(target, header.size, nodes, header.nodes)) return false;
+  for (size_t index = 0; index < header.statements; index++)
+    if (!restoreStatement(target, header.size, statements[index])) return false;
+  return true;
+}
+
+bool mapParse(Parse* target, Source const* parsed) {
+  // Loading aborts when the file does not exist; thus, check it first.
+  Buffer path  = createCachePath(parsed);
+  FILE*  probe = fopen(path.first, "rb");
+  if (!probe) {
+    disposeBuffer(&path);
+    return false;
+  }
+  fclose(probe);
+  Buffer cache;
+  bool   mapped = loadContents(&cache, path.first);
+  disposeBuffer(&path);
+
+  *target = (Parse){
+    .first    = NULL,
+    .after    = NULL,
+    .bound    = NULL,
+    .nodes    = {.first = NULL, .after = NULL, .bound = NULL},
+    .contents = parsed->contents.first
+  };
+  bool restored = restoreParse(target, parsed, cache);
+  releaseContents(&cache, mapped);
+  if (!restored) disposeParse(target);
+  return restored;
+}
@@ -7,28 +7,51 @@
 #include "source/api.h"
 
 #include <stddef.h>
+#include <stdint.h>
 
-size_t countExpressionNodes(Expression counted) {
-  return counted.after - counted.first;
+size_t countExpressionNodes(Expression counted) { return counted.count; }
+
+ExpressionNode const* getExpressionRoot(Parse source, Expression gotten) {
+  expect(gotten.count, "Expression does not have any nodes!");
+  return source.nodes.first + gotten.offset + gotten.count - 1;
+}
+
+String getExpressionSection(Parse source, Expression gotten) {
+  return getNodeSection(source, *getExpressionRoot(source, gotten));
+}
+
+String getNodeSection(Parse source, ExpressionNode gotten) {
+  char const* first = source.contents + gotten.start;
+  return createString(first, first + gotten.length);
 }
 
-String getExpressionSection(Expression gotten) {
-  return gotten.after[-1].section;
+ExpressionNode createExpressionNode(
+  Parse const* containing, size_t builtOperator, size_t builtArity,
+  String builtSection, uint32_t builtIdentifier) {
+  size_t start  = builtSection.first - containing->contents;
+  size_t length = countCharacters(builtSection);
+  expect(
+    start <= UINT32_MAX && length <= UINT32_MAX - start,
+    "Source is too large for expression nodes!");
+  expect(builtOperator <= UINT8_MAX, "Operator hash does not fit a node!");
+  expect(builtArity <= NODE_ARITY_LIMIT, "Arity does not fit a node!");
+  return (ExpressionNode){
+    .start      = (uint32_t)start,
+    .length     = (uint32_t)length,
+    .identifier = builtIdentifier,
+    .operator= builtOperator,
+    .arity = builtArity};
 }
 
-Expression createExpression(size_t initialCapacity) {
-  Expression created = {.first = NULL, .after = NULL, .bound = NULL};
-  reserveArray(&created, initialCapacity, ExpressionNode);
-  return created;
+void pushExpressionNode(Parse* target, ExpressionNode pushed) {
+  reserveArray(&target->nodes, 1, ExpressionNode);
+  *target->nodes.after++ = pushed;
 }
 
-void disposeExpression(Expression* disposed) {
-  disposed->first = allocateArray(disposed->first, 0, ExpressionNode);
-  disposed->after = disposed->first;
-  disposed->bound = disposed->first;
+size_t countPooledNodes(Parse counted) {
+  return counted.nodes.after - counted.nodes.first;
 }
 
-void pushExpressionNode(Expression* target, ExpressionNode pushed) {
-  reserveArray(target, 1, ExpressionNode);
-  *target->after++ = pushed;
+void truncateNodes(Parse* target, size_t kept) {
+  target->nodes.after = target->nodes.first + kept;
 }
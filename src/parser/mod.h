@@ -8,39 +8,54 @@
 #include "source/api.h"
 
 #include <stddef.h>
+#include <stdint.h>
 
-/* Empty expression with the given initial capacity. */
-Expression createExpression(size_t initialCapacity);
-/* Release the memory used by the given expression. */
-void       disposeExpression(Expression* disposed);
-/* Add the given node to the end of the given expression. */
-void       pushExpressionNode(Expression* target, ExpressionNode pushed);
+/* Least amount of lexemes in a range of statements that is parsed by a
+ * thread. */
+#define PARSE_CHUNK_LEXEMES (1 << 18)
+
+/* Node with the given operator hash, arity, section and identifier, whose
+ * section is in the source of the given parse. */
+ExpressionNode createExpressionNode(
+  Parse const* containing, size_t builtOperator, size_t builtArity,
+  String builtSection, uint32_t builtIdentifier);
+/* Add the given node to the end of the node pool of the given parse. */
+void   pushExpressionNode(Parse* target, ExpressionNode pushed);
+/* Amount of nodes in the node pool of the given parse. */
+size_t countPooledNodes(Parse counted);
+/* Remove the nodes after the given amount from the node pool of the given
+ * parse. */
+void   truncateNodes(Parse* target, size_t kept);
 /* Add a binding definition statement with the given name, type and value to the
  * given parse. */
-void       pushBindingDefinition(
-        Parse* target, String pushedName, Expression pushedType,
-        Expression pushedValue);
+void   pushBindingDefinition(
+    Parse* target, Lexeme pushedName, Expression pushedType,
+    Expression pushedValue);
 /* Add an inferred binding definition statement with the given name and
  * value to the given parse. */
 void pushInferredBindingDefinition(
-  Parse* target, String pushedName, Expression pushedValue);
+  Parse* target, Lexeme pushedName, Expression pushedValue);
 /* Add a variable definition statement with the given name, type and value to
  * the given parse. */
 void pushVariableDefinition(
-  Parse* target, String pushedName, Expression pushedType,
+  Parse* target, Lexeme pushedName, Expression pushedType,
   Expression pushedInitialValue);
 /* Add an inferred variable definition statement with the given name and
  * value to the given parse. */
 void pushInferredVariableDefinition(
-  Parse* target, String pushedName, Expression pushedInitialValue);
+  Parse* target, Lexeme pushedName, Expression pushedInitialValue);
 /* Add a defaulted definition statement with the given name, type and value to
  * the given parse. */
 void pushDefaultedVariableDefinition(
-  Parse* target, String pushedName, Expression pushedType);
+  Parse* target, Lexeme pushedName, Expression pushedType);
 /* Add a discarded expression statement with the given expression to the given
  * parse. */
 void pushDiscardedExpression(Parse* target, Expression pushedDiscarded);
 /* Remove the last statement from the given parse. */
 void popStatement(Parse* target);
-/* Parse the given lex into the given parse by reporting to the given source. */
-void parseLex(Parse* target, Source* reported, Lex parsed);
+/* Add the statements and nodes of the given parse to the end of the given
+ * parse, and release the given parse. Both must be of the same source file. */
+void appendParse(Parse* target, Parse* appended);
+/* Parse the given lexemes into the given parse by reporting to the given
+ * source. */
+void parseLexemes(Parse* target, Source* reported, LexemeStream parsed);
@@ -7,42 +7,31 @@
 #include "source/api.h"
 #include "utility/api.h"
 
-Parse createParse(Source* reported, Lex parsed) {
-  Parse created = {.first = NULL, .after = NULL, .bound = NULL};
-  parseLex(&created, reported, parsed);
+#include <stddef.h>
+#include <string.h>
+
+Parse createParse(Source* reported, LexemeStream parsed) {
+  Parse created = {
+    .first    = NULL,
+    .after    = NULL,
+    .bound    = NULL,
+    .nodes    = {.first = NULL, .after = NULL, .bound = NULL},
+    .contents = reported->contents.first
+  };
+  parseLexemes(&created, reported, parsed);
   return created;
 }
 
 void disposeParse(Parse* disposed) {
-  for (Statement* statement = disposed->first; statement < disposed->after;
-       statement++) {
-    switch (statement->tag) {
-    case STATEMENT_BINDING_DEFINITION:
-      disposeExpression(&statement->asBindingDefinition.type);
-      disposeExpression(&statement->asBindingDefinition.value);
-      break;
-    case STATEMENT_INFERRED_BINDING_DEFINITION:
-      disposeExpression(&statement->asInferredBindingDefinition.value);
-      break;
-    case STATEMENT_VARIABLE_DEFINITION:
-      disposeExpression(&statement->asVariableDefinition.type);
-      disposeExpression(&statement->asVariableDefinition.initialValue);
-      break;
-    case STATEMENT_INFERRED_VARIABLE_DEFINITION:
-      disposeExpression(&statement->asInferredVariableDefinition.initialValue);
-      break;
-    case STATEMENT_DEFAULTED_VARIABLE_DEFINITION:
-      disposeExpression(&statement->asDefaultedVariableDefinition.type);
-      break;
-    case STATEMENT_DISCARDED_EXPRESSION:
-      disposeExpression(&statement->asDiscardedExpression.discarded);
-      break;
-    default: unexpected("Unknown statement variant!");
-    }
-  }
+  // Expressions do not own their nodes; thus, releasing the pool releases all
+  // of them at once.
   disposed->first = allocateArray(disposed->first, 0, Statement);
   disposed->after = disposed->first;
   disposed->bound = disposed->first;
+  disposed->nodes.first =
+    allocateArray(disposed->nodes.first, 0, ExpressionNode);
+  disposed->nodes.after = disposed->nodes.first;
+  disposed->nodes.bound = disposed->nodes.first;
 }
 
 static void pushStatement(Parse* target, Statement pushed) {
@@ -51,10 +40,13 @@ static void pushStatement(Parse* target, Statement pushed) {
 }
 
 void pushBindingDefinition(
-  Parse* target, String pushedName, Expression pushedType,
+  Parse* target, Lexeme pushedName, Expression pushedType,
   Expression pushedValue) {
   BindingDefinition pushed = {
-    .name = pushedName, .type = pushedType, .value = pushedValue};
+    .name       = pushedName.section,
+    .identifier = pushedName.identifier,
+    .type       = pushedType,
+    .value      = pushedValue};
   pushStatement(
     target,
     (Statement){
@@ -62,8 +54,11 @@ void pushBindingDefinition(
 }
 
 void pushInferredBindingDefinition(
-  Parse* target, String pushedName, Expression pushedValue) {
-  InferredBindingDefinition pushed = {.name = pushedName, .value = pushedValue};
+  Parse* target, Lexeme pushedName, Expression pushedValue) {
+  InferredBindingDefinition pushed = {
+    .name       = pushedName.section,
+    .identifier = pushedName.identifier,
+    .value      = pushedValue};
   pushStatement(
     target, (Statement){
               .asInferredBindingDefinition = pushed,
@@ -71,10 +66,13 @@ void pushInferredBindingDefinition(
 }
 
 void pushVariableDefinition(
-  Parse* target, String pushedName, Expression pushedType,
+  Parse* target, Lexeme pushedName, Expression pushedType,
   Expression pushedInitialValue) {
   VariableDefinition pushed = {
-    .name = pushedName, .type = pushedType, .initialValue = pushedInitialValue};
+    .name         = pushedName.section,
+    .identifier   = pushedName.identifier,
+    .type         = pushedType,
+    .initialValue = pushedInitialValue};
   pushStatement(
     target,
     (Statement){
@@ -82,9 +80,11 @@ void pushVariableDefinition(
 }
 
 void pushInferredVariableDefinition(
-  Parse* target, String pushedName, Expression pushedInitialValue) {
+  Parse* target, Lexeme pushedName, Expression pushedInitialValue) {
   InferredVariableDefinition pushed = {
-    .name = pushedName, .initialValue = pushedInitialValue};
+    .name         = pushedName.section,
+    .identifier   = pushedName.identifier,
+    .initialValue = pushedInitialValue};
   pushStatement(
     target, (Statement){
               .asInferredVariableDefinition = pushed,
@@ -92,8 +92,11 @@ void pushInferredVariableDefinition(
 }
 
 void pushDefaultedVariableDefinition(
-  Parse* target, String pushedName, Expression pushedType) {
-  DefaultedVariableDefinition pushed = {.name = pushedName, .type = pushedType};
+  Parse* target, Lexeme pushedName, Expression pushedType) {
+  DefaultedVariableDefinition pushed = {
+    .name       = pushedName.section,
+    .identifier = pushedName.identifier,
+    .type       = pushedType};
   pushStatement(
     target, (Statement){
               .asDefaultedVariableDefinition = pushed,
@@ -109,3 +112,64 @@ void pushDiscardedExpression(Parse* target, Expression pushedDiscarded) {
 }
 
 void popStatement(Parse* target) { target->after--; }
+
+/* Move the given expression by the given amount of nodes in the pool. */
+static void shiftExpression(Expression* shifted, size_t amount) {
+  // Empty expressions do not refer to any nodes.
+  if (shifted->count) shifted->offset += amount;
+}
+
+/* Move the expressions of the given statement by the given amount of nodes in
+ * the pool. */
+static void shiftStatement(Statement* shifted, size_t amount) {
+  switch (shifted->tag) {
+  case STATEMENT_BINDING_DEFINITION:
+    shiftExpression(&shifted->asBindingDefinition.type, amount);
+    shiftExpression(&shifted->asBindingDefinition.value, amount);
+    break;
+  case STATEMENT_INFERRED_BINDING_DEFINITION:
+    shiftExpression(&shifted->asInferredBindingDefinition.value, amount);
+    break;
+  case STATEMENT_VARIABLE_DEFINITION:
+    shiftExpression(&shifted->asVariableDefinition.type, amount);
+    shiftExpression(&shifted->asVariableDefinition.initialValue, amount);
+    break;
+  case STATEMENT_INFERRED_VARIABLE_DEFINITION:
+    shiftExpression(
+      &shifted->asInferredVariableDefinition.initialValue, amount);
+    break;
+  case STATEMENT_DEFAULTED_VARIABLE_DEFINITION:
+    shiftExpression(&shifted->asDefaultedVariableDefinition.type, amount);
+    break;
+  case STATEMENT_DISCARDED_EXPRESSION:
+    shiftExpression(&shifted->asDiscardedExpression.discarded, amount);
+    break;
+  default: unexpected("Unknown statement variant!");
+  }
+}
+
+/* Copy the nodes of the given parse to the end of the node pool of the given
+ * parse. */
+static void appendNodes(Parse* target, Parse const* appended) {
+  size_t copied = countPooledNodes(*appended);
+  reserveArray(&target->nodes, copied, ExpressionNode);
+  if (copied)
+    memcpy(
+      target->nodes.after, appended->nodes.first,
+      copied * sizeof(ExpressionNode));
+  target->nodes.after += copied;
+}
+
+void appendParse(Parse* target, Parse* appended) {
+  // Appended nodes come after the nodes of the target; thus, their expressions
+  // are moved by that amount.
+  size_t shift = countPooledNodes(*target);
+  appendNodes(target, appended);
+  for (Statement const* statement = appended->first;
+       statement < appended->after; statement++) {
+    Statement pushed = *statement;
+    shiftStatement(&pushed, shift);
+    pushStatement(target, pushed);
+  }
+  disposeParse(appended);
+}
@@ -10,30 +10,78 @@
 #include <stdbool.h>
 #include <stddef.h>
 
+/* Expression node that waits for an operand to be parsed. */
+typedef struct {
+  /* Operator of the node. */
+  Operator           parsed;
+  /* Lexeme that the node started at. */
+  Lexeme             start;
+  /* Node that was built before the operator, which is the first operand of
+   * the binary and variary operators. */
+  ExpressionNode     before;
+  /* Amount of operands that were parsed. */
+  size_t             arity;
+  /* Precedence level of the expression that has the node. */
+  OperatorPrecedence level;
+  /* Precedence level of the operand that is waited for. */
+  OperatorPrecedence operand;
+} PendingNode;
+
+/* Dynamic array of pending nodes, which is used as a stack. */
+typedef struct {
+  /* Pointer to the first pending node if it exists. */
+  PendingNode* first;
+  /* Pointer to one after the last pending node. */
+  PendingNode* after;
+  /* Pointer to one after the last allocated pending node. */
+  PendingNode* bound;
+} PendingNodes;
+
 /* Context of the parsing process. */
 typedef struct {
   /* Target parse to add the parsed statements into. */
-  Parse*        target;
+  Parse*       target;
   /* Source to report to. */
-  Source*       reported;
-  /* Parsed lex. */
-  Lex           parsed;
-  /* Position of the currently parsed lexeme. */
-  Lexeme const* current;
-  /* Start of an unexpected group of lexemes. Null if it does not exist. */
-  Lexeme const* firstUnexpected;
-  /* Expression that is currently being built-up. */
-  Expression    built;
+  Source*      reported;
+  /* Parsed lexemes, which are lexed as they are parsed. */
+  LexemeStream parsed;
+  /* Section of an unexpected group of lexemes. Null if it does not exist. */
+  String       unexpected;
+  /* Index of the first node of the expression that is currently being built-up
+   * in the node pool of the target. */
+  size_t       built;
+  /* Nodes that wait for their operands to be parsed. */
+  PendingNodes pending;
 } Context;
 
+/* Amount of lexeme variants. */
+#define LEXEME_TAGS (LEXEME_ERROR + 1)
+
+/* Operator that could be parsed when a lexeme variant is current. */
+typedef struct {
+  /* Operator that starts with the lexeme if there is one. */
+  Operator candidate;
+  /* Whether there is an operator that starts with the lexeme. */
+  bool     exists;
+} Dispatch;
+
+/* Operators that start with each lexeme variant when there is not an operand
+ * before them, which are the nullary, prenary and cirnary operators. */
+static Dispatch cleanDispatches[LEXEME_TAGS];
+/* Operators that start with each lexeme variant when there is an operand
+ * before them, which are the postary, binary and variary operators. */
+static Dispatch operandDispatches[LEXEME_TAGS];
+
 /* Whether there is a lexeme to parse. */
 static bool checkLexemeExistance(Context* context) {
-  // EOF should not be parsed; thus, subtract by 1;
-  return context->current < context->parsed.after - 1;
+  // EOF should not be parsed; thus, there must be a lexeme after the current.
+  return checkNextLexeme(&context->parsed);
 }
 
 /* Lexeme that is parsed. */
-static Lexeme getCurrentLexeme(Context* context) { return *context->current; }
+static Lexeme getCurrentLexeme(Context* context) {
+  return getStreamCurrent(&context->parsed);
+}
 
 /* Whether there is a lexeme to lex and it is of the given variant. */
 static bool compareCurrent(Context* context, LexemeTag compared) {
@@ -42,7 +90,7 @@ static bool compareCurrent(Context* context, LexemeTag compared) {
 }
 
 /* Go to the next lexeme. */
-static void advanceOnce(Context* context) { context->current++; }
+static void advanceOnce(Context* context) { nextLexeme(&context->parsed); }
 
 /* Return the lexeme that was parsed and go to the next lexeme. */
 static Lexeme takeOnce(Context* context) {
@@ -67,7 +115,8 @@ static String createSectionFromSection(Context* context, String start) {
   // Ends at the end of the previous lexeme, rather than the start of the
   // current one. This way any characters that were skipped by the lexer between
   // them is not included in the created section.
-  return createString(start.first, context->current[-1].section.after);
+  return createString(
+    start.first, getStreamPrevious(&context->parsed).section.after);
 }
 
 /* Call `createSectionFromSection` with the section of the given lexeme. */
@@ -77,7 +126,8 @@ static String createSectionFromLexeme(Context* context, Lexeme start) {
 
 /* Call `createSectionFromSection` with the section of the given node. */
 static String createSectionFromNode(Context* context, ExpressionNode node) {
-  return createSectionFromSection(context, node.section);
+  return createSectionFromSection(
+    context, getNodeSection(*context->target, node));
 }
 
 /* Built a new node with the given operator, arity and section. */
@@ -85,24 +135,44 @@ static void buildNode(
   Context* context, Operator builtOperator, size_t builtArity,
   String builtSection) {
   pushExpressionNode(
-    &context->built, (ExpressionNode){
-                       .operator= builtOperator.hash,
-                       .arity   = builtArity,
-                       .section = builtSection});
+    context->target,
+    createExpressionNode(
+      context->target, builtOperator.hash, builtArity, builtSection, 0));
 }
 
 /* Last built node. */
 static ExpressionNode getLastBuiltNode(Context* context) {
-  return context->built.after[-1];
+  return context->target->nodes.after[-1];
 }
 
-/* Built expression. Clears the built expression field in context. */
+/* Built expression, which is the nodes since the last built expression. Starts
+ * the next expression after them. */
 static Expression getBuiltExpression(Context* context) {
-  Expression built = context->built;
-  context->built   = createExpression(0);
+  size_t     count = countPooledNodes(*context->target);
+  Expression built = {
+    .offset = context->built, .count = count - context->built};
+  context->built = count;
   return built;
 }
 
+/* Remove the nodes that were built after the given amount of nodes, which
+ * belonged to a statement that was not parsed. */
+static void discardBuiltNodes(Context* context, size_t kept) {
+  truncateNodes(context->target, kept);
+  context->built = kept;
+}
+
+/* Amount of nodes that wait for their operands. */
+static size_t countPendingNodes(Context* context) {
+  return context->pending.after - context->pending.first;
+}
+
+/* Add the given node to the top of the pending nodes. */
+static void pushPendingNode(Context* context, PendingNode pushed) {
+  reserveArray(&context->pending, 1, PendingNode);
+  *context->pending.after++ = pushed;
+}
+
 /* Result of parsing an syntactic object. */
 typedef enum {
   /* Object was successfull parsed. */
@@ -116,9 +186,6 @@ typedef enum {
   FAILURE
 } Result;
 
-// Prototype for recursivly parsing expressions.
-static Result parseExpression(Context* context, OperatorPrecedence parsedLevel);
-
 /* Try to parse a nullary expression node. */
 static Result
 parseNullaryNode(Context* context, Operator parsed, bool cleanParse) {
@@ -129,14 +196,21 @@ parseNullaryNode(Context* context, Operator parsed, bool cleanParse) {
   if (!cleanParse || !consumeOnce(context, parsed.asNullary.only))
     return NOT_THERE;
 
-  // Build the node without any operands.
-  buildNode(context, parsed, 0, createSectionFromLexeme(context, start));
+  // Build the node without any operands. The identifier only matters when the
+  // node accesses a symbol.
+  pushExpressionNode(
+    context->target,
+    createExpressionNode(
+      context->target, parsed.hash, 0, createSectionFromLexeme(context, start),
+      start.identifier));
   return SUCCESS;
 }
 
-/* Try to parse a prenary expression node. */
-static Result
-parsePrenaryNode(Context* context, Operator parsed, bool cleanParse) {
+/* Try to start a prenary expression node in an expression of the given
+ * precedence level. */
+static Result startPrenaryNode(
+  Context* context, Operator parsed, bool cleanParse,
+  OperatorPrecedence level) {
   Lexeme start = getCurrentLexeme(context);
   // As the prenary operators do not have any operands that come before them,
   // if its not a clean parse it cannot be a prenary expression. If the operator
@@ -144,17 +218,33 @@ parsePrenaryNode(Context* context, Operator parsed, bool cleanParse) {
   if (!cleanParse || !consumeOnce(context, parsed.asPrenary.before))
     return NOT_THERE;
 
-  // Parse the operand and build the node if successfull. The operand can be at
-  // the same level since the prenary operators are ordered right to left.
-  switch (parseExpression(context, parsed.precedence)) {
+  // Wait for the operand. The operand can be at the same level since the
+  // prenary operators are ordered right to left.
+  pushPendingNode(
+    context, (PendingNode){
+               .parsed  = parsed,
+               .start   = start,
+               .arity   = 0,
+               .level   = level,
+               .operand = parsed.precedence});
+  return SUCCESS;
+}
+
+/* Finish the given prenary expression node with the given operand result. */
+static Result
+finishPrenaryNode(Context* context, PendingNode finished, Result operand) {
+  // Build the node if the operand was successfully parsed.
+  switch (operand) {
   case SUCCESS:
-    buildNode(context, parsed, 1, createSectionFromLexeme(context, start));
+    buildNode(
+      context, finished.parsed, 1,
+      createSectionFromLexeme(context, finished.start));
     return SUCCESS;
   case NOT_THERE:
     highlightError(
-      context->reported, createSectionFromLexeme(context, start),
+      context->reported, createSectionFromLexeme(context, finished.start),
       "Expected an operand after the operator `%s`!",
-      nameLexeme(parsed.asPrenary.before));
+      nameLexeme(finished.parsed.asPrenary.before));
   case FAILURE: return FAILURE;
   default: unexpected("Unknown parse result!");
   }
@@ -173,9 +263,11 @@ parsePostaryNode(Context* context, Operator parsed, bool cleanParse) {
   return SUCCESS;
 }
 
-/* Try to parse a cirnary expression node. */
-static Result
-parseCirnaryNode(Context* context, Operator parsed, bool cleanParse) {
+/* Try to start a cirnary expression node in an expression of the given
+ * precedence level. */
+static Result startCirnaryNode(
+  Context* context, Operator parsed, bool cleanParse,
+  OperatorPrecedence level) {
   Lexeme start = getCurrentLexeme(context);
   // As the cirnary operators do not have any operands that come before them,
   // if its not a clean parse it cannot be a cirnary expression. If the opening
@@ -183,15 +275,30 @@ parseCirnaryNode(Context* context, Operator parsed, bool cleanParse) {
   if (!cleanParse || !consumeOnce(context, parsed.asCirnary.opening))
     return NOT_THERE;
 
-  // Parse the operand between the opening and closing lexemes. The precedence
-  // of the surrounded operand can be as low as possible since it is clearly
-  // marked with the opening and closing lexemes of the cirnary operator. The
-  // expression inside cannot be an assignment per the rules of the language.
-  switch (parseExpression(context, OPERATOR_ASSIGNMENT + 1)) {
+  // Wait for the operand between the opening and closing lexemes. The
+  // precedence of the surrounded operand can be as low as possible since it is
+  // clearly marked with the opening and closing lexemes of the cirnary
+  // operator. The expression inside cannot be an assignment per the rules of
+  // the language.
+  pushPendingNode(
+    context, (PendingNode){
+               .parsed  = parsed,
+               .start   = start,
+               .arity   = 0,
+               .level   = level,
+               .operand = OPERATOR_ASSIGNMENT + 1});
+  return SUCCESS;
+}
+
+/* Finish the given cirnary expression node with the given operand result. */
+static Result
+finishCirnaryNode(Context* context, PendingNode finished, Result operand) {
+  Operator parsed = finished.parsed;
+  switch (operand) {
   case SUCCESS: break;
   case NOT_THERE:
     highlightError(
-      context->reported, createSectionFromLexeme(context, start),
+      context->reported, createSectionFromLexeme(context, finished.start),
       "Expected an operand after the opening `%s`!",
       nameLexeme(parsed.asCirnary.opening));
   case FAILURE: return FAILURE;
@@ -201,62 +308,112 @@ parseCirnaryNode(Context* context, Operator parsed, bool cleanParse) {
   // Check the closing lexeme.
   if (!consumeOnce(context, parsed.asCirnary.closing)) {
     highlightError(
-      context->reported, createSectionFromLexeme(context, start),
+      context->reported, createSectionFromLexeme(context, finished.start),
       "Expected a closing `%s` for the opening `%s`!",
       nameLexeme(parsed.asCirnary.closing),
       nameLexeme(parsed.asCirnary.opening));
     highlightInfo(
-      context->reported, start.section, "Opening `%s` was here.",
+      context->reported, finished.start.section, "Opening `%s` was here.",
       nameLexeme(parsed.asCirnary.opening));
     return FAILURE;
   }
 
-  buildNode(context, parsed, 1, createSectionFromLexeme(context, start));
+  buildNode(
+    context, parsed, 1, createSectionFromLexeme(context, finished.start));
   return SUCCESS;
 }
 
-/* Try to parse a binary expression node. */
-static Result
-parseBinaryNode(Context* context, Operator parsed, bool cleanParse) {
+/* Try to start a binary expression node in an expression of the given
+ * precedence level. */
+static Result startBinaryNode(
+  Context* context, Operator parsed, bool cleanParse,
+  OperatorPrecedence level) {
+  Lexeme start = getCurrentLexeme(context);
   // If its a clean parse, there is no left operand. And, if the operator lexeme
   // variant is not there, the binary expression is not there.
   if (cleanParse || !consumeOnce(context, parsed.asBinary.between))
     return NOT_THERE;
-  ExpressionNode leftOperand = getLastBuiltNode(context);
 
-  // Parse the right operand that comes after the operator. The operand can only
-  // be something that binds thighter than the parsed operator since the binary
-  // operators are ordered left to right.
-  switch (parseExpression(context, parsed.precedence + 1)) {
+  // Wait for the right operand that comes after the operator. The operand can
+  // only be something that binds thighter than the parsed operator since the
+  // binary operators are ordered left to right.
+  pushPendingNode(
+    context, (PendingNode){
+               .parsed  = parsed,
+               .start   = start,
+               .before  = getLastBuiltNode(context),
+               .arity   = 1,
+               .level   = level,
+               .operand = parsed.precedence + 1});
+  return SUCCESS;
+}
+
+/* Finish the given binary expression node with the given result of the right
+ * operand. */
+static Result
+finishBinaryNode(Context* context, PendingNode finished, Result operand) {
+  // Build the node if the right operand was successfully parsed.
+  switch (operand) {
   case SUCCESS:
-    buildNode(context, parsed, 2, createSectionFromNode(context, leftOperand));
+    buildNode(
+      context, finished.parsed, 2,
+      createSectionFromNode(context, finished.before));
     return SUCCESS;
   case NOT_THERE:
     highlightError(
-      context->reported, createSectionFromNode(context, leftOperand),
+      context->reported, createSectionFromNode(context, finished.before),
       "Expected an operand after the operator `%s`!",
-      nameLexeme(parsed.asBinary.between));
+      nameLexeme(finished.parsed.asBinary.between));
   case FAILURE: return FAILURE;
   default: unexpected("Unknown parse result!");
   }
 }
 
-/* Try to parse a variary expression node. */
-static Result
-parseVariaryNode(Context* context, Operator parsed, bool cleanParse) {
+/* Try to start a variary expression node in an expression of the given
+ * precedence level. */
+static Result startVariaryNode(
+  Context* context, Operator parsed, bool cleanParse,
+  OperatorPrecedence level) {
   Lexeme start = getCurrentLexeme(context);
   // If its a clean parse, there is no first operand. And, if the opening lexeme
   // variant is not there, the variary expression is not there.
   if (cleanParse || !consumeOnce(context, parsed.asVariary.opening))
     return NOT_THERE;
-  ExpressionNode firstOperand = getLastBuiltNode(context);
 
-  // Try to parse the second operand. Operands of the variary operators after
-  // the first one can be any level like the cirnary operators, because they are
-  // all marked by the opening, separating and closing lexemes clearly.
-  switch (parseExpression(context, OPERATOR_ASSIGNMENT + 1)) {
-  case SUCCESS: break;
+  // Wait for the second operand. Operands of the variary operators after the
+  // first one can be any level like the cirnary operators, because they are all
+  // marked by the opening, separating and closing lexemes clearly.
+  pushPendingNode(
+    context, (PendingNode){
+               .parsed  = parsed,
+               .start   = start,
+               .before  = getLastBuiltNode(context),
+               .arity   = 1,
+               .level   = level,
+               .operand = OPERATOR_ASSIGNMENT + 1});
+  return SUCCESS;
+}
+
+/* Finish parsing an operand of the given variary expression node with the
+ * given result. Waits for the next operand if there is a separating lexeme. */
+static Result
+finishVariaryNode(Context* context, PendingNode finished, Result operand) {
+  Operator       parsed       = finished.parsed;
+  ExpressionNode firstOperand = finished.before;
+
+  switch (operand) {
+  case SUCCESS: finished.arity++; break;
   case NOT_THERE:
+    // Only the second operand is optional, which is the first one that is
+    // parsed after the opening lexeme.
+    if (finished.arity > 1) {
+      highlightError(
+        context->reported, createSectionFromNode(context, firstOperand),
+        "Expected an operand after the separating `%s`!",
+        nameLexeme(parsed.asVariary.separating));
+      return FAILURE;
+    }
+
     // If the closing lexeme is found, the expression is complete.
     if (consumeOnce(context, parsed.asVariary.closing)) {
       buildNode(
@@ -271,101 +428,133 @@ parseVariaryNode(Context* context, Operator parsed, bool cleanParse) {
       nameLexeme(parsed.asVariary.closing),
       nameLexeme(parsed.asVariary.opening));
     highlightInfo(
-      context->reported, start.section, "Opening `%s` was here.",
+      context->reported, finished.start.section, "Opening `%s` was here.",
       nameLexeme(parsed.asVariary.opening));
   case FAILURE: return FAILURE;
   default: unexpected("Unknown parse result!");
   }
 
-  // The first operand was there, and the second one was parsed just now; thus,
-  // there are 2 operands at the moment.
-  size_t arity = 2;
-
-  while (true) {
-    // If the closing lexeme is found, the expression is over.
-    if (consumeOnce(context, parsed.asVariary.closing)) break;
+  // If the closing lexeme is found, the expression is over.
+  if (consumeOnce(context, parsed.asVariary.closing)) {
+    buildNode(
+      context, parsed, finished.arity,
+      createSectionFromNode(context, firstOperand));
+    return SUCCESS;
+  }
 
-    // If the closing lexeme is not there, the separating one must be.
-    if (!consumeOnce(context, parsed.asVariary.separating)) {
-      highlightError(
-        context->reported, createSectionFromNode(context, firstOperand),
-        "Expected a closing `%s` for the opening `%s`!",
-        nameLexeme(parsed.asVariary.closing),
-        nameLexeme(parsed.asVariary.opening));
-      highlightInfo(
-        context->reported, start.section, "Opening `%s` was here.",
-        nameLexeme(parsed.asVariary.opening));
-      return FAILURE;
-    }
+  // If the closing lexeme is not there, the separating one must be.
+  if (!consumeOnce(context, parsed.asVariary.separating)) {
+    highlightError(
+      context->reported, createSectionFromNode(context, firstOperand),
+      "Expected a closing `%s` for the opening `%s`!",
+      nameLexeme(parsed.asVariary.closing),
+      nameLexeme(parsed.asVariary.opening));
+    highlightInfo(
+      context->reported, finished.start.section, "Opening `%s` was here.",
+      nameLexeme(parsed.asVariary.opening));
+    return FAILURE;
+  }
 
-    // After the separating lexeme, there should be another operand. As the
-    // operand is parsed successfuly the arity should be increased.
-    switch (parseExpression(context, OPERATOR_ASSIGNMENT + 1)) {
-    case SUCCESS: arity++; break;
-    case NOT_THERE:
-      highlightError(
-        context->reported, createSectionFromNode(context, firstOperand),
-        "Expected an operand after the separating `%s`!",
-        nameLexeme(parsed.asVariary.separating));
-    case FAILURE: return FAILURE;
-    default: unexpected("Unknown parse result!");
-    }
+  // The amount of operands is kept in the node, which limits it.
+  if (finished.arity == NODE_ARITY_LIMIT) {
+    highlightError(
+      context->reported, createSectionFromNode(context, firstOperand),
+      "There are too many operands for the `%s`!",
+      nameLexeme(parsed.asVariary.opening));
+    return FAILURE;
   }
 
-  buildNode(
-    context, parsed, arity, createSectionFromNode(context, firstOperand));
+  // After the separating lexeme, there should be another operand.
+  pushPendingNode(context, finished);
   return SUCCESS;
 }
 
-/* Try to parse an expression node. */
-static Result parseNode(
-  Context* context, OperatorPrecedence parsedLevel, size_t parsedInLevelIndex,
-  bool cleanParse) {
-  Operator parsed = getOperatorAt(parsedLevel, parsedInLevelIndex);
+/* Try to parse an expression node in an expression of the given precedence
+ * level. Nodes that have operands after their leading lexeme are started and
+ * left pending. */
+static Result startNode(
+  Context* context, Operator parsed, bool cleanParse,
+  OperatorPrecedence level) {
   switch (parsed.tag) {
   case OPERATOR_NULLARY: return parseNullaryNode(context, parsed, cleanParse);
-  case OPERATOR_PRENARY: return parsePrenaryNode(context, parsed, cleanParse);
+  case OPERATOR_PRENARY:
+    return startPrenaryNode(context, parsed, cleanParse, level);
   case OPERATOR_POSTARY: return parsePostaryNode(context, parsed, cleanParse);
-  case OPERATOR_CIRNARY: return parseCirnaryNode(context, parsed, cleanParse);
-  case OPERATOR_BINARY: return parseBinaryNode(context, parsed, cleanParse);
-  case OPERATOR_VARIARY: return parseVariaryNode(context, parsed, cleanParse);
+  case OPERATOR_CIRNARY:
+    return startCirnaryNode(context, parsed, cleanParse, level);
+  case OPERATOR_BINARY:
+    return startBinaryNode(context, parsed, cleanParse, level);
+  case OPERATOR_VARIARY:
+    return startVariaryNode(context, parsed, cleanParse, level);
   default: unexpected("Unknown operator variant!");
   }
 }
 
-/* Try to parse an expression. */
+/* Continue the given pending node with the given operand result. */
+static Result
+finishNode(Context* context, PendingNode finished, Result operand) {
+  switch (finished.parsed.tag) {
+  case OPERATOR_PRENARY: return finishPrenaryNode(context, finished, operand);
+  case OPERATOR_CIRNARY: return finishCirnaryNode(context, finished, operand);
+  case OPERATOR_BINARY: return finishBinaryNode(context, finished, operand);
+  case OPERATOR_VARIARY: return finishVariaryNode(context, finished, operand);
+  default: unexpected("Operator variant does not wait for operands!");
+  }
+}
+
+/* Try to parse an expression. Operands are parsed as nested expressions, whose
+ * parents are kept in the pending nodes instead of the call stack; thus, the
+ * depth of nesting only costs memory. */
 static Result parseExpression(Context* context, OperatorPrecedence parsed) {
+  size_t base   = countPendingNodes(context);
   Result result = NOT_THERE;
 
-  // Parse an expression on the given precedence level or higher.
-  for (OperatorPrecedence level = parsed; level < OPERATOR_LEVELS; level++) {
-    for (size_t inLevel = 0; inLevel < countInLevelOperators(level);
-         inLevel++) {
-      // Pass the clean parse flag depending on whether there is not a result.
-      switch (parseNode(context, level, inLevel, result == NOT_THERE)) {
-      case SUCCESS:
-        // Iterate starting from the parsed precedence level on success. This
-        // way, operators are correctly ordered from left to right. The ones
-        // that are associative from right to left, which is the prenary
-        // operators, handle it themselves by parsing an expression of the same
-        // level as their operand. Others, which are associative left to right,
-        // only parse operands with higher precedence levels than themselves.
-        // Since the loop variable is incremented at the end, subtract one to
-        // get the correct target level in the next iteration of the outer loop.
-        level  = parsed - 1;
-        result = SUCCESS;
-        break;
-      case NOT_THERE: continue;
-      case FAILURE: return FAILURE;
-      default: unexpected("Unknown parse result!");
-      }
+  // Parse an expression on the given precedence level or higher. Only the
+  // operator that starts with the current lexeme could be there, which is
+  // decided by whether there is a result to be its operand.
+  while (true) {
+    bool     cleanParse = result == NOT_THERE;
+    Dispatch dispatch =
+      (cleanParse ? cleanDispatches
+                  : operandDispatches)[getCurrentLexeme(context).tag];
+    size_t pending = countPendingNodes(context);
+
+    // Operators with lower precedence levels are parsed by the callers.
+    Result node = NOT_THERE;
+    if (dispatch.exists && dispatch.candidate.precedence >= parsed)
+      node = startNode(context, dispatch.candidate, cleanParse, parsed);
+
+    // When there is not a node, the expression is over. Give its result to
+    // the node that waits for it as an operand, or return it if there is none.
+    if (node == NOT_THERE) {
+      if (pending == base) return result;
+      PendingNode finished = *--context->pending.after;
+      parsed               = finished.level;
+      pending--;
+      node = finishNode(context, finished, result);
+    }
 
-      // Break from the inner loop on the success case.
-      break;
+    // Failure of an operand fails all the nodes that wait for it.
+    if (node == FAILURE) {
+      context->pending.after = context->pending.first + base;
+      return FAILURE;
     }
-  }
 
-  return result;
+    // Parse the operand of the node that waits for one as a new expression.
+    if (countPendingNodes(context) > pending) {
+      parsed = context->pending.after[-1].operand;
+      result = NOT_THERE;
+      continue;
+    }
+
+    // Continue from the parsed precedence level on success. This way,
+    // operators are correctly ordered from left to right. The ones that are
+    // associative from right to left, which is the prenary operators, handle
+    // it themselves by parsing an expression of the same level as their
+    // operand. Others, which are associative left to right, only parse
+    // operands with higher precedence levels than themselves.
+    result = SUCCESS;
+  }
 }
 
 /* Try to parse a binding definition. */
@@ -386,7 +575,7 @@ static Result parseBindingDefinition(Context* context) {
 
   // The type expression is optional, create an empty one. Empty means it was
   // not there. If there is a colon, the type expression must follow it.
-  Expression type = createExpression(0);
+  Expression type = {.offset = 0, .count = 0};
   if (consumeOnce(context, LEXEME_COLON)) {
     // Assignment expression should not be parsed because it consumes the value
     // expression as well. Also it is not allowed by the language rules.
@@ -425,9 +614,8 @@ static Result parseBindingDefinition(Context* context) {
 
   // If there are not any nodes in the type expression, it is inferred.
   if (countExpressionNodes(type))
-    pushBindingDefinition(context->target, identifier.section, type, value);
-  else
-    pushInferredBindingDefinition(context->target, identifier.section, value);
+    pushBindingDefinition(context->target, identifier, type, value);
+  else pushInferredBindingDefinition(context->target, identifier, value);
   return SUCCESS;
 }
 
@@ -449,7 +637,7 @@ static Result parseVariableDefinition(Context* context) {
 
   // The type expression is optional, create an empty one. Empty means it was
   // not there. If there is a colon, the type expression must follow it.
-  Expression type = createExpression(0);
+  Expression type = {.offset = 0, .count = 0};
   if (consumeOnce(context, LEXEME_COLON)) {
     // Assignment expression should not be parsed because it consumes the
     // initial value expression as well. Also it is not allowed by the language
@@ -470,7 +658,7 @@ static Result parseVariableDefinition(Context* context) {
   // The initial value expression is optional, create an empty one. Empty means
   // it was not there. If there is an equal sign, the initial value expression
   // must follow it.
-  Expression initialValue = createExpression(0);
+  Expression initialValue = {.offset = 0, .count = 0};
   if (consumeOnce(context, LEXEME_EQUAL)) {
     // Assignment expression is not allowed by the language rules.
     switch (parseExpression(context, OPERATOR_ASSIGNMENT + 1)) {
@@ -491,17 +679,14 @@ static Result parseVariableDefinition(Context* context) {
   if (countExpressionNodes(initialValue)) {
     // If there are not any nodes in the type expression, it is inferred.
     if (countExpressionNodes(type))
-      pushVariableDefinition(
-        context->target, identifier.section, type, initialValue);
+      pushVariableDefinition(context->target, identifier, type, initialValue);
     else
-      pushInferredVariableDefinition(
-        context->target, identifier.section, initialValue);
+      pushInferredVariableDefinition(context->target, identifier, initialValue);
   } else {
     // If the initial value is defaulted there must be a type expression.
     // Otherwise it is impossible to define a variable.
     if (countExpressionNodes(type)) {
-      pushDefaultedVariableDefinition(
-        context->target, identifier.section, type);
+      pushDefaultedVariableDefinition(context->target, identifier, type);
     } else {
       highlightError(
         context->reported, createSectionFromLexeme(context, start),
@@ -538,53 +723,62 @@ static Result parseStatement(Context* context) {
   return parseDiscardedExpression(context);
 }
 
-/* Report the unexpected group of lexemes. */
-static void reportUnexpected(Context* context, Lexeme const* afterUnexpected) {
-  if (!context->firstUnexpected) return;
+/* Add the given lexeme to the unexpected group of lexemes. */
+static void markUnexpected(Context* context, Lexeme marked) {
+  // Similar to `createSectionFromSection`, the section goes from the first
+  // unexpected lexeme to the end of the last one.
+  if (!context->unexpected.first)
+    context->unexpected.first = marked.section.first;
+  context->unexpected.after = marked.section.after;
+}
 
-  // Similar to `createSectionFromSection`, create a section from the first
-  // unexpected lexeme to the beginin of the lexeme after the unexpected group.
-  String unexpected = {
-    .first = context->firstUnexpected->section.first,
-    .after = afterUnexpected[-1].section.after};
+/* Report the unexpected group of lexemes. */
+static void reportUnexpected(Context* context) {
+  if (!context->unexpected.first) return;
 
   highlightError(
-    context->reported, unexpected, "Expected a statement instead of %s!",
-    countCharacters(unexpected) > 1 ? "these characters" : "this character");
+    context->reported, context->unexpected,
+    "Expected a statement instead of %s!",
+    countCharacters(context->unexpected) > 1 ? "these characters"
+                                             : "this character");
 
-  // Clear the unexpected start to indicate it is handled.
-  context->firstUnexpected = NULL;
+  // Clear the unexpected section to indicate it is handled.
+  context->unexpected = createString(NULL, NULL);
 }
 
 /* Run the parser with the context. */
 static void parse(Context* context) {
   while (checkLexemeExistance(context)) {
-    Lexeme const* start  = context->current;
-    Result        result = parseStatement(context);
+    Lexeme start  = getCurrentLexeme(context);
+    size_t nodes  = countPooledNodes(*context->target);
+    Result result = parseStatement(context);
 
     // If nothing was parsed, the lexeme is unexpected.
     if (result == NOT_THERE) {
-      if (!context->firstUnexpected) context->firstUnexpected = start;
+      markUnexpected(context, start);
       advanceOnce(context);
       continue;
     }
 
     // If there is a result, show the previously skipped unexpected group of
     // lexemes.
-    reportUnexpected(context, start);
+    reportUnexpected(context);
 
     if (result == SUCCESS) {
       // Statements end with a semicolon.
       if (!consumeOnce(context, LEXEME_SEMICOLON)) {
         highlightError(
-          context->reported, createSectionFromLexeme(context, *start),
+          context->reported, createSectionFromLexeme(context, start),
           "Expected a `;` after the statement!");
         popStatement(context->target);
+        discardBuiltNodes(context, nodes);
       }
       continue;
     }
 
-    // Result was a failure, skip until a synchronization lexeme.
+    // Result was a failure, skip until a synchronization lexeme. Nodes of the
+    // failed statement are not used.
+    discardBuiltNodes(context, nodes);
     if (!checkLexemeExistance(context)) break;
 
     // Skip the lexemes until the synchronization lexeme.
@@ -604,23 +798,195 @@ static void parse(Context* context) {
   // Show any unexpected characters at the end, which did not find an
   // oppurtinity to be reported because there might not have been a successful
   // parse after them.
-  reportUnexpected(context, context->current);
+  reportUnexpected(context);
+}
+
+/* Record the given operator as the one that starts with the given lexeme
+ * variant in the given dispatches. */
+static void
+addDispatch(Dispatch* dispatches, LexemeTag leading, Operator added) {
+  expect(!dispatches[leading].exists, "Operators share a leading lexeme!");
+  dispatches[leading] = (Dispatch){.candidate = added, .exists = true};
+}
+
+void initParser() {
+  // Find the leading lexeme of every operator, and whether it needs an operand
+  // before that lexeme.
+  for (OperatorPrecedence level = 0; level < OPERATOR_LEVELS; level++) {
+    for (size_t inLevel = 0; inLevel < countInLevelOperators(level);
+         inLevel++) {
+      Operator added = getOperatorAt(level, inLevel);
+      switch (added.tag) {
+      case OPERATOR_NULLARY:
+        addDispatch(cleanDispatches, added.asNullary.only, added);
+        break;
+      case OPERATOR_PRENARY:
+        addDispatch(cleanDispatches, added.asPrenary.before, added);
+        break;
+      case OPERATOR_POSTARY:
+        addDispatch(operandDispatches, added.asPostary.after, added);
+        break;
+      case OPERATOR_CIRNARY:
+        addDispatch(cleanDispatches, added.asCirnary.opening, added);
+        break;
+      case OPERATOR_BINARY:
+        addDispatch(operandDispatches, added.asBinary.between, added);
+        break;
+      case OPERATOR_VARIARY:
+        addDispatch(operandDispatches, added.asVariary.opening, added);
+        break;
+      default: unexpected("Unknown operator variant!");
+      }
+    }
+  }
+}
+
+/* Parse the given lexemes into the given parse by reporting to the given
+ * source. Returns the last lexeme, which is not parsed. */
+static Lexeme
+parseStream(Parse* target, Source* reported, LexemeStream parsed) {
+  // Pending nodes are kept in the context, so that their memory is reused by
+  // all the expressions.
+  Context context = {
+    .target     = target,
+    .reported   = reported,
+    .parsed     = parsed,
+    .unexpected = createString(NULL, NULL),
+    .built      = countPooledNodes(*target),
+    .pending    = {.first = NULL, .after = NULL, .bound = NULL}
+  };
+  parse(&context);
+  allocateArray(context.pending.first, 0, PendingNode);
 
   // Cannot use `compareCurrent` because that checks for existance, which does
   // not consider the last lexeme.
+  return getCurrentLexeme(&context);
+}
+
+/* Range of the lexemes of a source file that is parsed by a thread. */
+typedef struct {
+  /* Copy of the source file that keeps the reports of the range. */
+  Source       reported;
+  /* Lexemes of the range. Last one is the first lexeme of the next range, or
+   * the EOF. */
+  LexemeStream parsed;
+  /* Statements and nodes that are parsed from the range. */
+  Parse        target;
+} Fragment;
+
+/* Ranges of a source file that are parsed in parallel, in source order. */
+typedef struct {
+  /* Pointer to the first fragment. */
+  Fragment* first;
+  /* Pointer to one after the last fragment. */
+  Fragment* after;
+} Fragments;
+
+/* Whether parsing a statement always starts when the current lexeme is of the
+ * given variant. */
+static bool checkStatementLead(LexemeTag checked) {
+  // Definitions start with a keyword, and discarded expressions start with an
+  // operator that does not have an operand before it.
+  return checked == LEXEME_LET || checked == LEXEME_VAR ||
+         cleanDispatches[checked].exists;
+}
+
+/* Whether the lexeme at the given index of the given lex ends a range. Then,
+ * the parser is at the start of a statement after the lexeme without any
+ * unexpected lexemes before it, which is the same as starting to parse from
+ * the lexeme after it. */
+static bool checkRangeEnd(Lex checked, size_t index) {
+  // A semicolon after a statement lead is always consumed, either as the end
+  // of the started statement or while skipping the rest of it after an error.
+  // Lexeme after the semicolon is in both of the ranges as it is looked ahead;
+  // thus, it must not report an error. It cannot be the EOF either, which
+  // would make an empty range.
+  return index > 0 && index + 2 < countLexemes(checked) &&
+         getLexemeTag(checked, index) == LEXEME_SEMICOLON &&
+         checkStatementLead(getLexemeTag(checked, index - 1)) &&
+         getLexemeTag(checked, index + 1) != LEXEME_ERROR;
+}
+
+/* Parse the fragment at the given index of the given fragments. */
+static void parseFragment(void* fragments, size_t index) {
+  Fragments* context = fragments;
+  Fragment*  parsed  = context->first + index;
+  parseStream(&parsed->target, &parsed->reported, parsed->parsed);
+}
+
+/* Split the given lexemes, which are lexed at once, to at most the given
+ * amount of ranges. Parse the ranges in parallel into the given parse by
+ * reporting to the given source as if they were parsed in order. */
+static void parseRanges(
+  Parse* target, Source* reported, LexemeStream parsed, size_t count) {
+  Lex    lexed = parsed.lexed;
+  size_t total = countLexemes(lexed);
   expect(
-    getCurrentLexeme(context).tag == LEXEME_EOF,
+    getLexemeTag(lexed, total - 1) == LEXEME_EOF,
     "Lex does not end with an EOF!");
+
+  // Ranges end at the first statement boundary after their even share.
+  // Lexemes of the first range are already streamed from its start.
+  Fragments fragments;
+  fragments.first = allocateArray(NULL, count, Fragment);
+  fragments.after = fragments.first;
+  for (size_t first = 0; first < total - 1;) {
+    // Last range ends at the EOF.
+    size_t ranges = fragments.after - fragments.first + 1;
+    size_t last   = total - 1;
+    if (ranges < count) {
+      size_t index = total / count * ranges;
+      if (index < first) index = first;
+      while (index < total && !checkRangeEnd(lexed, index)) index++;
+      if (index < total) last = index + 1;
+    }
+
+    Fragment* fragment = fragments.after++;
+    fragment->reported = deferSource(reported);
+    fragment->target   = (Parse){
+        .first    = NULL,
+        .after    = NULL,
+        .bound    = NULL,
+        .nodes    = {.first = NULL, .after = NULL, .bound = NULL},
+        .contents = target->contents
+    };
+    if (first) {
+      fragment->parsed =
+        createLexRangeStream(&fragment->reported, lexed, first, last + 1);
+    } else {
+      fragment->parsed             = parsed;
+      fragment->parsed.source      = &fragment->reported;
+      fragment->parsed.lexed.count = last + 1;
+    }
+    first = last;
+  }
+  runTasks(&parseFragment, &fragments, fragments.after - fragments.first);
+
+  // Show the reports and join the statements in the order of the ranges.
+  for (Fragment* fragment = fragments.first; fragment < fragments.after;
+       fragment++) {
+    flushSource(reported, &fragment->reported);
+    appendParse(target, &fragment->target);
+  }
+  fragments.first = allocateArray(fragments.first, 0, Fragment);
 }
 
-void parseLex(Parse* target, Source* reported, Lex parsed) {
-  // Create a context and pass its pointer, because all functions take a context
-  // pointer this removes the need for taking the address of the context.
-  parse(&(Context){
-    .target          = target,
-    .reported        = reported,
-    .parsed          = parsed,
-    .current         = parsed.first,
-    .firstUnexpected = NULL,
-    .built           = createExpression(0)});
+void parseLexemes(Parse* target, Source* reported, LexemeStream parsed) {
+  // Only the files that are lexed at once are parsed in parallel, as the
+  // ranges are found by scanning the lexemes. There is no use of more ranges
+  // than the processors.
+  size_t count = 1;
+  if (parsed.lexed.tags) {
+    count         = countProcessors();
+    size_t chunks = countLexemes(parsed.lexed) / PARSE_CHUNK_LEXEMES;
+    if (count > chunks) count = chunks;
+  }
+  if (count > 1) {
+    parseRanges(target, reported, parsed, count);
+    return;
+  }
+
+  expect(
+    parseStream(target, reported, parsed).tag == LEXEME_EOF,
+    "Lex does not end with an EOF!");
 }
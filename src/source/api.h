@@ -5,22 +5,90 @@
 
 #include "utility/api.h"
 
+#include <stdbool.h>
+
+/* Amount of characters that are put after the contents of a loaded file. */
+#define SENTINEL_SIZE 2
+
+/* Positions of the first characters of the lines in a source file. */
+typedef struct {
+  /* Pointer to the first line start if it exists. */
+  char const** first;
+  /* Pointer to one after the last line start. */
+  char const** after;
+  /* Pointer to one after the last allocated line start. */
+  char const** bound;
+} LineIndex;
+
+/* Level of a report. */
+typedef enum {
+  /* Report of an error. */
+  REPORT_ERROR,
+  /* Report of a warning. */
+  REPORT_WARNING,
+  /* Report of an information. */
+  REPORT_INFO
+} ReportLevel;
+
+/* Report that is kept to be printed later. */
+typedef struct {
+  /* Level of the report. */
+  ReportLevel level;
+  /* Highlighted section of the source file. Empty if the report does not
+   * highlight a section. */
+  String      highlighted;
+  /* Formatted message, which is null-terminated. */
+  char*       message;
+} Report;
+
+/* Dynamic array of reports in the order they were made. */
+typedef struct {
+  /* Pointer to the first report if it exists. */
+  Report* first;
+  /* Pointer to one after the last report. */
+  Report* after;
+  /* Pointer to one after the last allocated report. */
+  Report* bound;
+} Reports;
+
 /* Contents of a source file. */
 typedef struct {
   /* Relative path of the source file without the file extension. */
   char const* name;
   /* Contents of the source file. */
   Buffer      contents;
+  /* Whether the contents are mapped from the file instead of being read. */
+  bool        mapped;
+  /* Line starts of the contents. Empty until a location is reported. */
+  LineIndex   lines;
   /* Amount of errors orginated in the source file. */
   int         errors;
   /* Amount of warnings orginated in the source file. */
   int         warnings;
+  /* Reports that are kept instead of being printed. Null if the reports are
+   * printed as they are made. */
+  Reports*    deferred;
 } Source;
 
+/* Initialize the module. */
+void   initSource(void);
 /* Load the source file at the given name. */
 Source createSource(char const* loadedFileName);
 /* Dispose the contents of the given source file. */
 void   disposeSource(Source* disposed);
+/* Copy of the given source file that keeps its reports instead of printing
+ * them. Parts of a source file can be processed in parallel with the copies,
+ * and their reports can be printed in order afterwards. */
+Source deferSource(Source const* deferred);
+/* Print the reports kept by the given copy to the given source file in the
+ * order they were made, and release the copy. */
+void   flushSource(Source* target, Source* deferred);
+/* Load the contents of the file at the given path to the given buffer, and put
+ * a null-terminator and a new line after them. Maps the file if possible,
+ * otherwise reads it. Returns whether the contents were mapped. */
+bool   loadContents(Buffer* target, char const* path);
+/* Release the given contents that were loaded with the given mapping flag. */
+void   releaseContents(Buffer* released, bool mapped);
 /* Report an error at the given source file with the given formatted message. */
 void   reportError(Source* reported, char const* format, ...);
 /* Report a warning at the given source file with the given formatted message.
@@ -0,0 +1,160 @@
+// SPDX-FileCopyrightText: 2022 Cem Geçgel <gecgelcem@outlook.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "source/api.h"
+#include "source/mod.h"
+#include "utility/api.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+
+#if defined(_WIN32)
+  #include <windows.h>
+#else
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
+#endif
+
+/* Put the sentinel to the given position, which has enough space after it. */
+static void writeSentinel(char* written) {
+  // Put the null-terminator as end of file character, and a new line, which
+  // makes sure that there is always a line that could be reported to user.
+  written[0] = 0;
+  written[1] = '\n';
+}
+
+/* Given stream after checking that it was opened. */
+static FILE* expectStream(FILE* opened) {
+  expect(opened, "Could not open file!");
+  return opened;
+}
+
+#if defined(_WIN32)
+
+/* Try to map the file at the given path with a sentinel after it. Returns
+ * null if the file was mapped; otherwise, a stream to read the file from. */
+static FILE* mapContents(Buffer* target, char const* path) {
+  HANDLE file = CreateFileA(
+    path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+    FILE_ATTRIBUTE_NORMAL, NULL);
+  expect(file != INVALID_HANDLE_VALUE, "Could not open file!");
+
+  // Only regular files with contents can be mapped.
+  LARGE_INTEGER fileSize;
+  if (
+    GetFileType(file) != FILE_TYPE_DISK || !GetFileSizeEx(file, &fileSize) ||
+    !fileSize.QuadPart) {
+    CloseHandle(file);
+    return expectStream(fopen(path, "r"));
+  }
+  size_t size = fileSize.QuadPart;
+
+  // A view cannot be larger than the file; thus, the sentinel must fit in the
+  // zeroed characters after the end of the file in the last page.
+  SYSTEM_INFO system;
+  GetSystemInfo(&system);
+  size_t pageSize = system.dwPageSize;
+  size_t mapped   = (size + SENTINEL_SIZE + pageSize - 1) / pageSize * pageSize;
+  if (mapped != (size + pageSize - 1) / pageSize * pageSize) {
+    CloseHandle(file);
+    return expectStream(fopen(path, "r"));
+  }
+
+  // Map the file as copy-on-write so that the sentinel could be written.
+  HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_WRITECOPY, 0, 0, NULL);
+  CloseHandle(file);
+  if (!mapping) return expectStream(fopen(path, "r"));
+  char* view = MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0);
+  CloseHandle(mapping);
+  if (!view) return expectStream(fopen(path, "r"));
+
+  writeSentinel(view + size);
+  *target = (Buffer){
+    .first = view,
+    .after = view + size + SENTINEL_SIZE,
+    .bound = view + mapped};
+  return NULL;
+}
+
+/* Release the mapped contents. */
+static void unmapContents(Buffer* unmapped) {
+  expect(UnmapViewOfFile(unmapped->first), "Could not unmap the file!");
+}
+
+#else
+
+/* Try to map the file at the given path with a sentinel after it. Returns
+ * null if the file was mapped; otherwise, a stream to read the file from. */
+static FILE* mapContents(Buffer* target, char const* path) {
+  int file = open(path, O_RDONLY);
+  expect(file != -1, "Could not open file!");
+
+  // Only regular files with contents can be mapped. Others, like pipes, must be
+  // read. Reuse the opened file, because a pipe cannot be opened again after
+  // its writer is gone.
+  struct stat status;
+  if (fstat(file, &status) || !S_ISREG(status.st_mode) || !status.st_size)
+    return expectStream(fdopen(file, "r"));
+  size_t size     = status.st_size;
+  size_t pageSize = sysconf(_SC_PAGESIZE);
+  size_t mapped   = (size + SENTINEL_SIZE + pageSize - 1) / pageSize * pageSize;
+
+  // Reserve zeroed pages for the file and the sentinel; then, map the file over
+  // the start of them. This way the sentinel has space even when the file ends
+  // at a page boundary. File is mapped private, so the characters after the
+  // end of the file in the last page can be written without changing the file.
+  char* reserved = mmap(
+    NULL, mapped, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (reserved == MAP_FAILED) return expectStream(fdopen(file, "r"));
+  if (
+    mmap(
+      reserved, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, file,
+      0) == MAP_FAILED) {
+    munmap(reserved, mapped);
+    return expectStream(fdopen(file, "r"));
+  }
+  close(file);
+
+  writeSentinel(reserved + size);
+  *target = (Buffer){
+    .first = reserved,
+    .after = reserved + size + SENTINEL_SIZE,
+    .bound = reserved + mapped};
+  return NULL;
+}
+
+/* Release the mapped contents. */
+static void unmapContents(Buffer* unmapped) {
+  expect(
+    !munmap(unmapped->first, unmapped->bound - unmapped->first),
+    "Could not unmap the file!");
+}
+
+#endif
+
+bool loadContents(Buffer* target, char const* path) {
+  // Prefer mapping the file, which does not copy the contents.
+  FILE* stream = mapContents(target, path);
+  if (!stream) return true;
+
+  // Otherwise, buffer the file contents.
+  *target = createBuffer(0);
+  appendStream(target, stream);
+  fclose(stream);
+
+  reserveArray(target, SENTINEL_SIZE, char);
+  writeSentinel(target->after);
+  target->after += SENTINEL_SIZE;
+  return false;
+}
+
+void releaseContents(Buffer* released, bool mapped) {
+  if (mapped) unmapContents(released);
+  else disposeBuffer(released);
+  released->first = NULL;
+  released->after = NULL;
+  released->bound = NULL;
+}
@@ -5,21 +5,50 @@
 #include "source/mod.h"
 #include "utility/api.h"
 
+#include <stddef.h>
+#include <string.h>
+
+/* Add the given line start to the end of the given line index. */
+static void pushLineStart(LineIndex* target, char const* pushed) {
+  reserveArray(target, 1, char const*);
+  *target->after++ = pushed;
+}
+
+void indexLines(Source* indexed) {
+  // Lines are indexed once, and there is always at least one line.
+  if (indexed->lines.first) return;
+
+  // Every new line starts a line after it. Use `memchr` to find them, because
+  // it checks many characters at once.
+  char const* position = indexed->contents.first;
+  char const* after    = indexed->contents.after;
+  pushLineStart(&indexed->lines, position);
+  while ((position = memchr(position, '\n', after - position)))
+    pushLineStart(&indexed->lines, ++position);
+}
+
+void disposeLines(Source* disposed) {
+  disposed->lines.first = allocateArray(disposed->lines.first, 0, char const*);
+  disposed->lines.after = disposed->lines.first;
+  disposed->lines.bound = disposed->lines.first;
+}
+
 Location createLocation(Source containing, char const* coresponding) {
-  Location result = {
-    .source = containing, .position = coresponding, .line = 1, .column = 1};
-  // Count the columns by looking at the characters that come before the
-  // location.
-  for (char const* before = containing.contents.first; before < coresponding;
-       before++)
-    // Count the line if a newline is found.
-    if (*before == '\n') {
-      result.line++;
-      result.column = 1;
-    } else {
-      result.column++;
-    }
-  return result;
+  // Binary search for the last line that starts at or before the location.
+  char const* const* low  = containing.lines.first;
+  char const* const* high = containing.lines.after;
+  while (high - low > 1) {
+    char const* const* middle = low + (high - low) / 2;
+    if (*middle <= coresponding) low = middle;
+    else high = middle;
+  }
+
+  // Count the columns from the start of the line.
+  return (Location){
+    .source   = containing,
+    .position = coresponding,
+    .line     = (int)(low - containing.lines.first) + 1,
+    .column   = (int)(coresponding - *low) + 1};
 }
 
 Location findLineStart(Location inLine) {
@@ -32,18 +61,17 @@ Location findLineStart(Location inLine) {
 }
 
 Location finLineEnd(Location inLine) {
-  // Find the line end by looking  at the characters that come after the
-  // location.
-  for (char const* after = inLine.position;
-       after < inLine.source.contents.after; after++)
-    // If a new line is found, the line end is the position before that.
-    if (*after == '\n')
-      return (Location){
-        .source   = inLine.source,
-        .position = after - 1,
-        .line     = inLine.line,
-        .column   = inLine.column + after - 1 - inLine.position};
-
-  // Above loop should find a new line at worst at the end of the file.
-  unexpected("File does not end with a new line!");
+  // The line after should start after the new line that ends this one. Above
+  // should exist at worst at the end of the file.
+  expect(
+    inLine.line < inLine.source.lines.after - inLine.source.lines.first,
+    "File does not end with a new line!");
+
+  // Line end is the position before the new line.
+  char const* end = inLine.source.lines.first[inLine.line] - 2;
+  return (Location){
+    .source   = inLine.source,
+    .position = end,
+    .line     = inLine.line,
+    .column   = inLine.column + (int)(end - inLine.position)};
 }
@@ -29,7 +29,12 @@ typedef struct {
   Location last;
 } Portion;
 
-/* Location of the character at the given position in the given source file. */
+/* Index the line starts of the given source file if they are not indexed. */
+void     indexLines(Source* indexed);
+/* Release the memory used by the line index of the given source file. */
+void     disposeLines(Source* disposed);
+/* Location of the character at the given position in the given source file,
+ * which must have its lines indexed. */
 Location createLocation(Source containing, char const* coresponding);
 /* Location of the start of the line of the given location. */
 Location findLineStart(Location inLine);
@@ -9,8 +9,13 @@
 #include <stdbool.h>
 #include <stdio.h>
 #include <string.h>
+#include <threads.h>
 #include <vadefs.h>
 
+/* Lock that keeps the reports of the source files that are compiled in
+ * parallel from mixing. */
+static mtx_t reportLock;
+
 /* Log the formatted message at the given level for the given source file to the
  * given stream. Prints the message by passing the variable arguments and the
  * format string to `fprintf`. */
@@ -20,10 +25,12 @@
     va_list arguments = NULL;                                              \
     va_start(arguments, format);                                           \
     /* First print the file information; then, the message. */             \
+    expect(mtx_lock(&reportLock) == thrd_success, "Could not lock!");      \
     fprintf(                                                               \
       targetStream, "%s.tr: %s: ", (reportedSource).name, logLevelString); \
     vfprintf(targetStream, format, arguments);                             \
     fputc('\n', targetStream);                                             \
+    expect(mtx_unlock(&reportLock) == thrd_success, "Could not unlock!");  \
     va_end(arguments);                                                     \
   } while (false)
 
@@ -35,8 +42,10 @@
     /* Transfer the variable amount of arguments to `fprintf`. */             \
     va_list arguments = NULL;                                                 \
     va_start(arguments, format);                                              \
+    indexLines(&(reportedSource));                                            \
     Portion portion = createPortion(reportedSource, highlighted);             \
     /* First print the file and line information; then, the message. */       \
+    expect(mtx_lock(&reportLock) == thrd_success, "Could not lock!");         \
     fprintf(                                                                  \
       targetStream, "%s.tr:%u:%u:%u:%u: %s: ", (reportedSource).name,         \
       portion.first.line, portion.first.column, portion.last.line,            \
@@ -45,9 +54,48 @@
     fputc('\n', targetStream);                                                \
     /* Underline the portion that should be highlighted after the message. */ \
     underlinePortion(portion, targetStream);                                  \
+    expect(mtx_unlock(&reportLock) == thrd_success, "Could not unlock!");     \
     va_end(arguments);                                                        \
   } while (false)
 
+/* Keep the formatted message at the given level for the given part of the given
+ * source file to print it later. Formats the message by passing the variable
+ * arguments and the format string to `vsnprintf`. */
+#define keepArguments(reportedSource, keptLevel, keptHighlighted)              \
+  do {                                                                         \
+    /* Transfer the variable amount of arguments to `keepReport`. */           \
+    va_list arguments = NULL;                                                  \
+    va_start(arguments, format);                                               \
+    keepReport(reportedSource, keptLevel, keptHighlighted, format, arguments); \
+    va_end(arguments);                                                         \
+  } while (false)
+
+/* Keep a report at the given level, which highlights the given section, with
+ * the message that is formatted from the given format and arguments. */
+static void keepReport(
+  Source* reported, ReportLevel level, String highlighted, char const* format,
+  va_list arguments) {
+  // Format the message now, because the arguments might not live until the
+  // report is printed. First, find the length of the message.
+  va_list measured;
+  va_copy(measured, arguments);
+  int length = vsnprintf(NULL, 0, format, measured);
+  va_end(measured);
+  expect(length >= 0, "Could not format the report!");
+  char* message = allocateArray(NULL, length + 1, char);
+  vsnprintf(message, length + 1, format, arguments);
+
+  reserveArray(reported->deferred, 1, Report);
+  *reported->deferred->after++ =
+    (Report){.level = level, .highlighted = highlighted, .message = message};
+}
+
+void initSource() {
+  expect(
+    mtx_init(&reportLock, mtx_plain) == thrd_success,
+    "Could not create the report lock!");
+}
+
 Source createSource(char const* name) {
   // Join the name with the extension.
   Buffer path = createBuffer(strlen(name) + 4);
@@ -56,52 +104,100 @@ Source createSource(char const* name) {
   appendString(&path, viewTerminated("tr"));
   appendCharacter(&path, 0);
 
-  // Open and buffer the source file contents.
-  FILE* source = fopen(path.first, "r");
+  // Load the source file contents.
+  Buffer contents;
+  bool   mapped = loadContents(&contents, path.first);
   disposeBuffer(&path);
-  expect(source, "Could not open file!");
 
-  Buffer contents = createBuffer(0);
-  appendStream(&contents, source);
+  return (Source){
+    .name     = name,
+    .contents = contents,
+    .mapped   = mapped,
+    .lines    = {.first = NULL, .after = NULL, .bound = NULL},
+    .errors   = 0,
+    .warnings = 0,
+    .deferred = NULL
+  };
+}
 
-  // Put the null-terminator as end of file character, and a new line, which
-  // makes sure that there is always a line that could be reported to user.
-  appendCharacter(&contents, 0);
-  appendCharacter(&contents, '\n');
+Source deferSource(Source const* deferred) {
+  // Lines are not shared, as they are only indexed when a report is printed.
+  Source copy    = *deferred;
+  copy.lines     = (LineIndex){.first = NULL, .after = NULL, .bound = NULL};
+  copy.errors    = 0;
+  copy.warnings  = 0;
+  copy.deferred  = allocateArray(NULL, 1, Reports);
+  *copy.deferred = (Reports){.first = NULL, .after = NULL, .bound = NULL};
+  return copy;
+}
 
-  return (Source){
-    .name = name, .contents = contents, .errors = 0, .warnings = 0};
+void flushSource(Source* target, Source* deferred) {
+  // Print the messages as they are; thus, they are not formatted again.
+  for (Report const* report = deferred->deferred->first;
+       report < deferred->deferred->after; report++) {
+    bool highlighting = report->highlighted.first;
+    switch (report->level) {
+    case REPORT_ERROR:
+      if (highlighting)
+        highlightError(target, report->highlighted, "%s", report->message);
+      else reportError(target, "%s", report->message);
+      break;
+    case REPORT_WARNING:
+      if (highlighting)
+        highlightWarning(target, report->highlighted, "%s", report->message);
+      else reportWarning(target, "%s", report->message);
+      break;
+    case REPORT_INFO:
+      if (highlighting)
+        highlightInfo(target, report->highlighted, "%s", report->message);
+      else reportInfo(target, "%s", report->message);
+      break;
+    default: unexpected("Unknown report level!");
+    }
+    allocateArray(report->message, 0, char);
+  }
+  allocateArray(deferred->deferred->first, 0, Report);
+  deferred->deferred = allocateArray(deferred->deferred, 0, Reports);
 }
 
-void disposeSource(Source* disposed) { disposeBuffer(&disposed->contents); }
+void disposeSource(Source* disposed) {
+  releaseContents(&disposed->contents, disposed->mapped);
+  disposeLines(disposed);
+}
 
 void reportError(Source* reported, char const* format, ...) {
-  reportArguments(*reported, stderr, "error");
+  if (reported->deferred) keepArguments(reported, REPORT_ERROR, EMPTY_STRING);
+  else reportArguments(*reported, stderr, "error");
   reported->errors++;
 }
 
 void reportWarning(Source* reported, char const* format, ...) {
-  reportArguments(*reported, stdout, "warning");
+  if (reported->deferred) keepArguments(reported, REPORT_WARNING, EMPTY_STRING);
+  else reportArguments(*reported, stdout, "warning");
   reported->warnings++;
 }
 
 void reportInfo(Source* reported, char const* format, ...) {
-  reportArguments(*reported, stdout, "info");
+  if (reported->deferred) keepArguments(reported, REPORT_INFO, EMPTY_STRING);
+  else reportArguments(*reported, stdout, "info");
 }
 
 void highlightError(
   Source* reported, String highlighted, char const* format, ...) {
-  highlightArguments(*reported, stderr, "error");
+  if (reported->deferred) keepArguments(reported, REPORT_ERROR, highlighted);
+  else highlightArguments(*reported, stderr, "error");
   reported->errors++;
 }
 
 void highlightWarning(
   Source* reported, String highlighted, char const* format, ...) {
-  highlightArguments(*reported, stdout, "warning");
+  if (reported->deferred) keepArguments(reported, REPORT_WARNING, highlighted);
+  else highlightArguments(*reported, stdout, "warning");
   reported->warnings++;
 }
 
 void highlightInfo(
   Source* reported, String highlighted, char const* format, ...) {
-  highlightArguments(*reported, stdout, "info");
+  if (reported->deferred) keepArguments(reported, REPORT_INFO, highlighted);
+  else highlightArguments(*reported, stdout, "info");
 }
@@ -5,6 +5,7 @@
 
 #include <stdbool.h>
 #include <stddef.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 
@@ -39,66 +40,163 @@ char const* trimRainfallSourcePath(char const* fullPath);
     (targetArray)->bound = (targetArray)->first + capacity;               \
   }
 
-/* Lowest ratio of used capacity to total capacity thay is allowed on bucket
- * arrays. */
-#define MIN_USED_CAPACITY_RATIO 0.5
-/* Factor to scale the capacity of bucket arrays in each growth. */
-#define GROWTH_MULTIPLIER       16
+/* Memory that is allocated in chunks, and released all at once. Blocks are
+ * allocated by bumping a pointer in the last chunk, and the most recently
+ * allocated block can grow and shrink in place. */
+typedef struct {
+  /* Pointer to the first chunk if it exists. */
+  char** first;
+  /* Pointer to one after the last chunk. */
+  char** after;
+  /* Pointer to one after the last allocated chunk. */
+  char** bound;
+  /* Pointer to the first unused byte of the last chunk. */
+  char*  unused;
+  /* Pointer to one after the last byte of the last chunk. */
+  char*  end;
+  /* Most recently allocated block. Null if it was released or there is not
+   * any. */
+  char*  last;
+} Arena;
+
+/* Empty arena, which does not allocate until a block is allocated from it. */
+Arena createArena(void);
+/* Release the memory used by the given arena, which includes all the blocks
+ * that were allocated from it. */
+void  disposeArena(Arena* disposed);
+/* Allocate a memory block with the given amount of bytes from the given arena.
+ * If a previous memory block from the arena is given tries to change its size,
+ * which is done in place if it is the most recent block. If the bytes are
+ * zero, releases the previous block, which only gives its memory back if it is
+ * the most recent block. */
+void* allocateInArena(
+  Arena* arena, void* reallocatedBlock, size_t allocatedSize);
+
+/* Call `allocateInArena` with amount of bytes enough to have the given amount
+ * of elements of the given type. */
+#define allocateArenaArray(                                             \
+  arena, reallocatedArray, allocatedElementCount, AllocatedElementType) \
+  (AllocatedElementType*)allocateInArena(                               \
+    arena, reallocatedArray,                                            \
+    (allocatedElementCount) * sizeof(AllocatedElementType))
+
+/* Make sure the given amount of space exists at the end of the given dynamic
+ * array, whose elements are allocated from the given arena. When necessary,
+ * grows by at least half of the current capacity. */
+#define reserveArenaArray(                                         \
+  arena, targetArray, reservedSize, ReservedElementType)           \
+  /* Find whether growth is necessary. */                          \
+  size_t capacity = (targetArray)->bound - (targetArray)->first;   \
+  size_t count    = (targetArray)->after - (targetArray)->first;   \
+  size_t space    = capacity - count;                              \
+  if (space < (reservedSize)) {                                    \
+    /* Grow the dynamic array. */                                  \
+    capacity += max((reservedSize)-space, capacity / 2);           \
+    (targetArray)->first = allocateArenaArray(                     \
+      arena, (targetArray)->first, capacity, ReservedElementType); \
+    (targetArray)->after = (targetArray)->first + count;           \
+    (targetArray)->bound = (targetArray)->first + capacity;        \
+  }
+
+/* Most amount of buckets that are allowed to be used in a bucket array for
+ * every eight buckets. Robin hood probing keeps the probe sequences short even
+ * when the array is nearly full. */
+#define MAX_USED_BUCKETS_PER_EIGHT 7
+/* Amount of buckets that is allocated for a bucket array that grows from
+ * empty. */
+#define MIN_BUCKET_COUNT           16
+
+/* Hashcode that is stored for the given string in a bucket. Most significant
+ * bit is always set, because a zero hashcode marks an empty bucket. */
+#define hashBucket(hashedString) \
+  (calculateHashcode(hashedString) | ~(SIZE_MAX >> 1))
+
+/* Distance of the given bucket at the given index from the index its
+ * hashcode points to in a bucket array with the given mask. */
+#define measureBucket(measuredBucket, measuredIndex, bucketMask) \
+  (((measuredIndex) - (measuredBucket)->hash) & (bucketMask))
 
-/* Insert the given bucket to the one of the given string. Starts at the bucket
- * that is pointed by the hashcode of the string, and ends at the bucket one
- * before that by wrapping at the array boundary. Bucket or its first member
- * should be a string. */
+/* Place the given bucket, which has its hashcode, to the given bucket array,
+ * which has an empty bucket. Buckets that are closer to the index their
+ * hashcode points to are moved forward to make space for the placed bucket;
+ * thus, all the buckets are as close as they can be. Bucket must have a `hash`
+ * member. */
+#define placeBucket(targetArray, placedBucket, PlacedBucketType)                 \
+  do {                                                                           \
+    size_t           mask     = (targetArray)->after - (targetArray)->first - 1; \
+    /* Bucket that is carried forward, and its distance from its start. */       \
+    PlacedBucketType carried  = (placedBucket);                                  \
+    size_t           distance = 0;                                               \
+    for (size_t index = carried.hash & mask;; index = (index + 1) & mask) {      \
+      PlacedBucketType* bucket = (targetArray)->first + index;                   \
+      if (!bucket->hash) {                                                       \
+        *bucket = carried;                                                       \
+        break;                                                                   \
+      }                                                                          \
+      /* Swap with the bucket if it is closer to its start. */                   \
+      size_t bucketDistance = measureBucket(bucket, index, mask);                \
+      if (bucketDistance < distance) {                                           \
+        PlacedBucketType swapped = *bucket;                                      \
+        *bucket                  = carried;                                      \
+        carried                  = swapped;                                      \
+        distance                 = bucketDistance;                               \
+      }                                                                          \
+      distance++;                                                                \
+    }                                                                            \
+  } while (false)
+
+/* Insert the given bucket to the given bucket array, whose amount of buckets
+ * is a power of two. Doubles the amount of buckets if necessary. Bucket or its
+ * first member should be a string, and it must have a `hash` member. */
 #define insertBucket(                                                          \
-  targetArray, insertedBucket, bucketCount, inserterFunction, creatorFunction, \
-  disposerFunction, TargetArrayType, AccessedBucketType)                       \
+  targetArray, insertedBucket, bucketCount, creatorFunction, disposerFunction, \
+  TargetArrayType, InsertedBucketType)                                         \
   size_t capacity = (targetArray)->after - (targetArray)->first;               \
   /* Grow if necessary. */                                                     \
   if (                                                                         \
-    capacity == 0 ||                                                           \
-    (targetArray)->bucketCount >= capacity * MIN_USED_CAPACITY_RATIO) {        \
-    /* If capacity is zero, make it finite. */                                 \
-    if (!capacity) capacity = 1;                                               \
-    capacity *= GROWTH_MULTIPLIER;                                             \
-    /* Rehash by inserting all buckets that have a finite member again */      \
-    TargetArrayType new = creatorFunction(capacity);                           \
-    for (AccessedBucketType const* bucket = (targetArray)->first;              \
-         bucket < (targetArray)->after; bucket++)                              \
-      if (countCharacters(*(String const*)bucket))                             \
-        inserterFunction(&new, *bucket);                                       \
+    ((targetArray)->bucketCount + 1) * 8 >                                     \
+    capacity * MAX_USED_BUCKETS_PER_EIGHT) {                                   \
+    /* Rehash by placing all the used buckets again. Hashcodes are stored      \
+     * in the buckets; thus, the strings are not hashed again. */              \
+    TargetArrayType grown =                                                    \
+      creatorFunction(capacity ? capacity * 2 : MIN_BUCKET_COUNT);             \
+    for (InsertedBucketType const* moved = (targetArray)->first;               \
+         moved < (targetArray)->after; moved++)                                \
+      if (moved->hash) placeBucket(&grown, *moved, InsertedBucketType);        \
+    grown.bucketCount = (targetArray)->bucketCount;                            \
     /* Swap the new array with the old one. */                                 \
-    disposerFunction(target);                                                  \
-    *target = new;                                                             \
+    disposerFunction(targetArray);                                             \
+    *(targetArray) = grown;                                                    \
   }                                                                            \
-  size_t hash = calculateHashcode(*(String const*)&(insertedBucket));          \
-  for (size_t index = 0; index < capacity; index++) {                          \
-    AccessedBucketType* bucket =                                               \
-      (targetArray)->first + (hash + index) % capacity;                        \
-    if (!countCharacters(*(String const*)bucket)) {                            \
-      *bucket = insertedBucket;                                                \
-      (targetArray)->bucketCount++;                                            \
-      return;                                                                  \
-    }                                                                          \
-  }                                                                            \
-  unexpected("Could not find an empty bucket!");
+  InsertedBucketType placed = (insertedBucket);                                \
+  placed.hash               = hashBucket(*(String const*)&placed);             \
+  placeBucket(targetArray, placed, InsertedBucketType);                        \
+  (targetArray)->bucketCount++
 
 /* Access the bucket of the given string at the given source array of the given
  * bucket type. Starts at the bucket that is pointed by the hashcode of the
- * string, and ends at the bucket one before that by wrapping at the array
- * boundary. Returns the bucket that has a string that equals to the given one.
- * Returns null if cannot find any equal bucket. Bucket or its first member
- * should be a string. */
-#define accessBucket(sourceArray, accessedString, AccessedBucketType)  \
-  size_t capacity = (sourceArray).after - (sourceArray).first;         \
-  size_t hash     = calculateHashcode(accessedString);                 \
-  for (size_t index = 0; index < capacity; index++) {                  \
-    AccessedBucketType const* bucket =                                 \
-      (sourceArray).first + (hash + index) % capacity;                 \
-    if (compareStringEquality(*(String const*)bucket, accessedString)) \
-      return bucket;                                                   \
-  }                                                                    \
-  /* If none was equal, the accessed bucket does not exist. */         \
-  return NULL
+ * string, and stops at an empty bucket or a bucket that is closer to its start
+ * than the accessed string would be, because robin hood probing would have
+ * placed the accessed string before those. Returns the bucket that has a
+ * string that equals to the given one. Returns null if cannot find any equal
+ * bucket. Bucket or its first member should be a string, and it must have a
+ * `hash` member. */
+#define accessBucket(sourceArray, accessedString, AccessedBucketType)   \
+  size_t capacity = (sourceArray).after - (sourceArray).first;          \
+  if (!capacity) return NULL;                                           \
+  size_t mask = capacity - 1;                                           \
+  size_t hash = hashBucket(accessedString);                             \
+  for (size_t index = hash & mask, distance = 0;;                       \
+       index = (index + 1) & mask, distance++) {                        \
+    AccessedBucketType const* bucket = (sourceArray).first + index;     \
+    if (!bucket->hash || measureBucket(bucket, index, mask) < distance) \
+      return NULL;                                                      \
+    /* Compare the strings only if the hashcodes are equal. */          \
+    if (                                                                \
+      bucket->hash == hash &&                                           \
+      compareStringEquality(*(String const*)bucket, accessedString))    \
+      return bucket;                                                    \
+  }
 
 /* Aborts if the given condition does not hold, after printing the given
  * message with the file and line information of the Rainfall source file. */
@@ -163,18 +261,27 @@ void   appendString(Buffer* target, String appended);
 /* Insert all the bytes from the given stream to the end of the given buffer. */
 void   appendStream(Buffer* target, FILE* appended);
 
+/* String in a set with its hashcode. */
+typedef struct {
+  /* String that is the member. */
+  String member;
+  /* Hashcode of the member, which is zero if the bucket is empty. */
+  size_t hash;
+} SetBucket;
+
 /* Dynamicly allocated array of strings that uses hashcode for fast element
  * existance checking. */
 typedef struct {
-  /* Pointer to the first string if it exists. */
-  String* first;
-  /* Pointer to one after the last string. */
-  String* after;
+  /* Pointer to the first bucket if it exists. */
+  SetBucket* first;
+  /* Pointer to one after the last bucket. */
+  SetBucket* after;
   /* Amount of strings. */
-  size_t  members;
+  size_t     members;
 } Set;
 
-/* Empty set with the given initial capacity. */
+/* Empty set with the given initial capacity, which is rounded up to a power of
+ * two. */
 Set           createSet(size_t initialCapacity);
 /* Release the memory used by the given set. */
 void          disposeSet(Set* disposed);
@@ -191,6 +298,8 @@ typedef struct {
   String key;
   /* The index value. */
   size_t value;
+  /* Hashcode of the key, which is zero if the bucket is empty. */
+  size_t hash;
 } MapEntry;
 
 /* Dynamicly allocated array of string and index pairs that uses hashcode for
@@ -204,7 +313,8 @@ typedef struct {
   size_t    entries;
 } Map;
 
-/* Empty map with the given initial capacity. */
+/* Empty map with the given initial capacity, which is rounded up to a power of
+ * two. */
 Map  createMap(size_t initialCapacity);
 /* Release the memory used by the given map. */
 void disposeMap(Map* disposed);
@@ -220,3 +330,16 @@ String const*   accessKey(Map source, String accessedKey);
 /* Pointer to the index in the given map that corresponds to the given key.
  * Returns null if there is no entry with the given key. */
 size_t const*   accessValue(Map source, String accessedKey);
+
+/* Function that runs the task at the given index with the given argument that
+ * is shared by all the tasks. */
+typedef void (*Task)(void* shared, size_t index);
+
+/* Amount of processors that are available to the calling thread. A thread that
+ * runs tasks is given its share of the processors of the thread that created
+ * the tasks. */
+size_t countProcessors(void);
+/* Run the tasks with the indices upto the given count by calling the given
+ * function with the given shared argument on multiple threads. Returns after
+ * all the tasks are complete. */
+void   runTasks(Task run, void* shared, size_t count);
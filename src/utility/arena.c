@@ -0,0 +1,100 @@
+// SPDX-FileCopyrightText: 2022 Cem Geçgel <gecgelcem@outlook.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "utility/api.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+/* Amount of bytes that is allocated for a chunk, unless a block needs more. */
+#define ARENA_CHUNK_SIZE (1 << 16)
+/* Amount of bytes every block is aligned to, which is enough for any type. It
+ * is also the size of the header before a block, which keeps the size of the
+ * block. */
+#define ARENA_ALIGNMENT  16
+
+/* Given amount of bytes rounded up to the alignment of the blocks. */
+static size_t alignBlockSize(size_t aligned) {
+  return (aligned + ARENA_ALIGNMENT - 1) & ~(size_t)(ARENA_ALIGNMENT - 1);
+}
+
+/* Size of the given block, which is kept in its header. */
+static size_t* accessBlockSize(char* accessed) {
+  return (size_t*)(accessed - ARENA_ALIGNMENT);
+}
+
+/* Make sure the last chunk of the given arena has the given amount of unused
+ * bytes. Adds a new chunk when necessary, and the unused bytes of the previous
+ * chunk are not used anymore. */
+static void reserveChunk(Arena* target, size_t reserved) {
+  if (
+    target->after > target->first &&
+    (size_t)(target->end - target->unused) >= reserved)
+    return;
+  size_t size  = max(reserved, ARENA_CHUNK_SIZE);
+  char*  chunk = allocateArray(NULL, size, char);
+  reserveArray(target, 1, char*);
+  *target->after++ = chunk;
+  target->unused   = chunk;
+  target->end      = chunk + size;
+}
+
+Arena createArena() {
+  return (Arena){
+    .first  = NULL,
+    .after  = NULL,
+    .bound  = NULL,
+    .unused = NULL,
+    .end    = NULL,
+    .last   = NULL};
+}
+
+void disposeArena(Arena* disposed) {
+  for (char** chunk = disposed->first; chunk < disposed->after; chunk++)
+    allocateArray(*chunk, 0, char);
+  disposed->first  = allocateArray(disposed->first, 0, char*);
+  disposed->after  = disposed->first;
+  disposed->bound  = disposed->first;
+  disposed->unused = NULL;
+  disposed->end    = NULL;
+  disposed->last   = NULL;
+}
+
+void* allocateInArena(
+  Arena* arena, void* reallocatedBlock, size_t allocatedSize) {
+  char* block  = reallocatedBlock;
+  bool  recent = block && block == arena->last;
+
+  // Only the most recent block gives its memory back when it is released. The
+  // others stay until the arena is released.
+  if (!allocatedSize) {
+    if (recent) {
+      arena->unused = block - ARENA_ALIGNMENT;
+      arena->last   = NULL;
+    }
+    return NULL;
+  }
+
+  // Most recent block is resized in place if it still fits in its chunk; thus,
+  // a dynamic array that is the only one growing is never copied.
+  size_t aligned = alignBlockSize(allocatedSize);
+  if (recent && (size_t)(arena->end - block) >= aligned) {
+    *accessBlockSize(block) = allocatedSize;
+    arena->unused           = block + aligned;
+    return block;
+  }
+
+  // Otherwise, bump a new block after its header, and copy the previous block
+  // into it.
+  reserveChunk(arena, ARENA_ALIGNMENT + aligned);
+  char* allocated             = arena->unused + ARENA_ALIGNMENT;
+  *accessBlockSize(allocated) = allocatedSize;
+  arena->unused               = allocated + aligned;
+  arena->last                 = allocated;
+  if (block) {
+    size_t copied = *accessBlockSize(block);
+    memcpy(allocated, block, copied < allocatedSize ? copied : allocatedSize);
+  }
+  return allocated;
+}
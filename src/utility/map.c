@@ -4,11 +4,20 @@
 #include "utility/api.h"
 
 #include <stddef.h>
+#include <string.h>
 
 Map createMap(size_t initialCapacity) {
-  Map new   = {.first = NULL, .after = NULL, .entries = 0};
-  new.first = allocateArray(new.first, initialCapacity, MapEntry);
-  new.after = new.first + initialCapacity;
+  Map new = {.first = NULL, .after = NULL, .entries = 0};
+  if (!initialCapacity) return new;
+
+  // Buckets are found by masking the hashcodes; thus, the capacity must be a
+  // power of two.
+  size_t capacity = 1;
+  while (capacity < initialCapacity) capacity *= 2;
+  new.first = allocateArray(new.first, capacity, MapEntry);
+  new.after = new.first + capacity;
+  // Empty buckets are recognized by their zero hashcodes.
+  memset(new.first, 0, capacity * sizeof(MapEntry));
   return new;
 }
 
@@ -18,16 +27,9 @@ void disposeMap(Map* disposed) {
   disposed->entries = 0;
 }
 
-/* Insert the given entry to the given map. */
-static void insertEntryWhole(Map* target, MapEntry inserted) {
-  insertBucket(
-    target, inserted, entries, insertEntryWhole, createMap, disposeMap, Map,
-    MapEntry);
-}
-
 void insertEntry(Map* target, String insertedKey, size_t insertedValue) {
-  MapEntry inserted = {.key = insertedKey, .value = insertedValue};
-  insertEntryWhole(target, inserted);
+  MapEntry inserted = {.key = insertedKey, .value = insertedValue, .hash = 0};
+  insertBucket(target, inserted, entries, createMap, disposeMap, Map, MapEntry);
 }
 
 MapEntry const* accessEntry(Map source, String accessedKey) {
@@ -35,9 +37,11 @@ MapEntry const* accessEntry(Map source, String accessedKey) {
 }
 
 String const* accessKey(Map source, String accessedKey) {
-  return &accessEntry(source, accessedKey)->key;
+  MapEntry const* entry = accessEntry(source, accessedKey);
+  return entry ? &entry->key : NULL;
 }
 
 size_t const* accessValue(Map source, String accessedKey) {
-  return &accessEntry(source, accessedKey)->value;
+  MapEntry const* entry = accessEntry(source, accessedKey);
+  return entry ? &entry->value : NULL;
 }
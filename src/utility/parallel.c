@@ -0,0 +1,92 @@
+// SPDX-FileCopyrightText: 2022 Cem Geçgel <gecgelcem@outlook.com>
+// SPDX-License-Identifier: GPL-3.0-or-later
+
+#include "utility/api.h"
+
+#include <stdatomic.h>
+#include <stddef.h>
+#include <threads.h>
+
+#if defined(_WIN32)
+  #include <windows.h>
+#else
+  #include <unistd.h>
+#endif
+
+/* Amount of processors given to the calling thread by the tasks it runs, or
+ * zero if it is not running tasks; then, all the processors are available. */
+static _Thread_local size_t budget = 0;
+
+/* Amount of processors of the system. */
+static size_t countSystemProcessors(void) {
+#if defined(_WIN32)
+  SYSTEM_INFO system;
+  GetSystemInfo(&system);
+  long processors = (long)system.dwNumberOfProcessors;
+#else
+  long processors = sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+  // Make sure there is at least a processor even if the query failed.
+  return processors > 0 ? (size_t)processors : 1;
+}
+
+size_t countProcessors(void) {
+  return budget ? budget : countSystemProcessors();
+}
+
+/* Shared state of the threads that run tasks. */
+typedef struct {
+  /* Function that runs the tasks. */
+  Task          run;
+  /* Argument that is passed to all the tasks. */
+  void*         shared;
+  /* Amount of tasks. */
+  size_t        count;
+  /* Amount of processors given to each thread. */
+  size_t        share;
+  /* Index of the next task that is not taken by a thread. */
+  atomic_size_t next;
+} Pool;
+
+/* Take and run tasks from the given pool until all are taken. */
+static int work(void* pool) {
+  Pool* context = pool;
+  budget        = context->share;
+  for (size_t index;
+       (index = atomic_fetch_add(&context->next, 1)) < context->count;)
+    context->run(context->shared, index);
+  return 0;
+}
+
+void runTasks(Task run, void* shared, size_t count) {
+  // There is no use of more threads than the tasks or the processors. Calling
+  // thread works as well; thus, one less thread is created.
+  size_t processors = countProcessors();
+  size_t helpers    = (count < processors ? count : processors);
+  if (helpers) helpers--;
+
+  // Split the processors between the threads, so the tasks that run tasks
+  // themselves do not create more threads than the processors.
+  Pool pool = {
+    .run    = run,
+    .shared = shared,
+    .count  = count,
+    .share  = processors / (helpers + 1)};
+  atomic_init(&pool.next, 0);
+
+  thrd_t* threads = allocateArray(NULL, helpers, thrd_t);
+  for (size_t index = 0; index < helpers; index++)
+    expect(
+      thrd_create(threads + index, &work, &pool) == thrd_success,
+      "Could not create a thread!");
+
+  size_t previous = budget;
+  work(&pool);
+  budget = previous;
+
+  for (size_t index = 0; index < helpers; index++)
+    expect(
+      thrd_join(threads[index], NULL) == thrd_success,
+      "Could not join a thread!");
+  allocateArray(threads, 0, thrd_t);
+}
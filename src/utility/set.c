@@ -4,26 +4,41 @@
 #include "utility/api.h"
 
 #include <stddef.h>
+#include <string.h>
 
 Set createSet(size_t initialCapacity) {
-  Set created   = {.first = NULL, .after = NULL, .members = 0};
-  created.first = allocateArray(created.first, initialCapacity, String);
-  created.after = created.first + initialCapacity;
+  Set created = {.first = NULL, .after = NULL, .members = 0};
+  if (!initialCapacity) return created;
+
+  // Buckets are found by masking the hashcodes; thus, the capacity must be a
+  // power of two.
+  size_t capacity = 1;
+  while (capacity < initialCapacity) capacity *= 2;
+  created.first = allocateArray(created.first, capacity, SetBucket);
+  created.after = created.first + capacity;
+  // Empty buckets are recognized by their zero hashcodes.
+  memset(created.first, 0, capacity * sizeof(SetBucket));
   return created;
 }
 
 void disposeSet(Set* disposed) {
-  disposed->first   = allocateArray(disposed->first, 0, String);
+  disposed->first   = allocateArray(disposed->first, 0, SetBucket);
   disposed->after   = disposed->first;
   disposed->members = 0;
 }
 
 void insertMember(Set* target, String inserted) {
-  insertBucket(
-    target, inserted, members, insertMember, createSet, disposeSet, Set,
-    String);
+  SetBucket bucket = {.member = inserted, .hash = 0};
+  insertBucket(target, bucket, members, createSet, disposeSet, Set, SetBucket);
+}
+
+/* Pointer to the bucket in the given set that has the given string. Returns
+ * null if there is no bucket with the given string. */
+static SetBucket const* accessMemberBucket(Set source, String accessed) {
+  accessBucket(source, accessed, SetBucket);
 }
 
 String const* accessMember(Set source, String accessed) {
-  accessBucket(source, accessed, String);
+  SetBucket const* bucket = accessMemberBucket(source, accessed);
+  return bucket ? &bucket->member : NULL;
 }
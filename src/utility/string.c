@@ -5,6 +5,8 @@
 
 #include <stdbool.h>
 #include <stddef.h>
+#include <stdint.h>
+#include <string.h>
 
 String const EMPTY_STRING = {.first = NULL, .after = NULL};
 
@@ -32,18 +34,42 @@ bool compareStringEquality(String leftChecked, String rightChecked) {
   return true;
 }
 
-/* Prime number for combining hashes. `53` is selected because the English
- * alphabet has 26 characters. Identifiers in the Thrice source are made out of
- * upper and lower case English letters, and underscores; thus, the prime is
- * the amount of different hashcodes there could be for a character. */
-#define HASHCODE_PRIME_FACTOR 53
+/* Odd constant with well distributed bits that combines the hashcode with a
+ * word of characters. */
+#define HASHCODE_COMBINER 0x9E3779B97F4A7C15u
+/* Odd constants with well distributed bits that spread every bit of the
+ * hashcode to all the others. */
+#define HASHCODE_MIXER_1  0xBF58476D1CE4E5B9u
+#define HASHCODE_MIXER_2  0x94D049BB133111EBu
+
+/* Given hashcode with all of its bits spread to the others. */
+static uint64_t mixHashcode(uint64_t mixed) {
+  mixed ^= mixed >> 30;
+  mixed *= HASHCODE_MIXER_1;
+  mixed ^= mixed >> 27;
+  mixed *= HASHCODE_MIXER_2;
+  mixed ^= mixed >> 31;
+  return mixed;
+}
 
 size_t calculateHashcode(String calculated) {
-  // Combine and accumulate the hashcodes for all the characters.
-  size_t hashcode = 0;
-  for (char const* i = calculated.first; i < calculated.after; i++) {
-    hashcode *= HASHCODE_PRIME_FACTOR;
-    hashcode += *i;
+  // Start with the amount of characters so that the trailing zeros of the last
+  // word are not ignored.
+  size_t   count    = countCharacters(calculated);
+  uint64_t hashcode = count * HASHCODE_COMBINER;
+
+  // Combine and mix 8 characters at a time; then, the remaining ones. Tables
+  // mask the hashcodes; thus, all the bits must depend on all the characters.
+  char const* word = calculated.first;
+  for (; calculated.after - word >= 8; word += 8) {
+    uint64_t value;
+    memcpy(&value, word, 8);
+    hashcode = mixHashcode((hashcode ^ value) * HASHCODE_COMBINER);
+  }
+  if (word < calculated.after) {
+    uint64_t value = 0;
+    memcpy(&value, word, calculated.after - word);
+    hashcode = mixHashcode((hashcode ^ value) * HASHCODE_COMBINER);
   }
-  return hashcode;
+  return (size_t)hashcode;
 }